@@ -0,0 +1,299 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file reconstruction.cpp
+ * @brief Benchmark of the unfused versus fused MUSCL reconstruction.
+ *
+ * Runs the same simulation from the same initial state with two
+ * reconstruction paths, alternating them over a few rounds:
+ * - unfused: gradients stored in `Fields`, then a separate MUSCL pass with
+ *   the limiter called through a function pointer (one indirect call per
+ *   face and variable);
+ * - fused: the stage instantiation selected by `init_pipeline` (gradient
+ *   and MUSCL in one pass over the neighbors, inlined limiter).
+ *
+ * Both paths use the same compile-time Riemann solver, so the flux
+ * evaluation is not part of the comparison.
+ *
+ * Usage: eulercpp_bench_reconstruction <input file> [iterations]
+ *
+ * Reports the best time per iteration of both variants and the largest
+ * difference between the final solutions.
+ *
+ * @author Alessio Improta
+ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <eulercpp/input/input.hpp>
+#include <eulercpp/math/limiters.hpp>
+#include <eulercpp/mesh/mesh.hpp>
+#include <eulercpp/simulation/pipeline.hpp>
+#include <eulercpp/simulation/preprocess.hpp>
+#include <eulercpp/simulation/simulation.hpp>
+#include <eulercpp/output/logger.hpp>
+#include <eulercpp/physics/boundaries.hpp>
+#include <eulercpp/physics/corrections.hpp>
+#include <eulercpp/physics/fluxes.hpp>
+#include <eulercpp/physics/sources.hpp>
+#include <eulercpp/physics/timestep.hpp>
+#include <eulercpp/math/gradients.hpp>
+#include <eulercpp/math/reconstruction.hpp>
+#include <eulercpp/math/solution_update.hpp>
+
+using namespace eulercpp;
+
+/** @brief Gradient kernel selected at run time */
+static StageFunction gradient_kernel = nullptr;
+
+/** @brief Flux kernel selected at run time */
+static StageFunction flux_kernel = nullptr;
+
+/** @brief Limiter selected at run time */
+static math::LimiterFunction limiter = nullptr;
+
+/**
+ * @brief Selects the kernels of the unfused stage.
+ *
+ * @param sim Reference to the Simulation object.
+ * @throws std::invalid_argument if a scheme is unknown.
+ */
+static void init_unfused(const Simulation& sim) {
+    const auto& numerical = sim.input.numerical;
+
+    limiter = math::get_limiter(numerical.limiter);
+
+    switch (sim.fields.dimension()) {
+        case 1:     gradient_kernel = math::compute_gradients<1>;  break;
+        case 3:     gradient_kernel = math::compute_gradients<3>;  break;
+        default:    gradient_kernel = math::compute_gradients<2>;  break;
+    }
+
+    switch (numerical.riemann) {
+        case physics::Riemann::RUSANOV:
+            flux_kernel = physics::compute_fluxes<physics::Riemann::RUSANOV>;
+            break;
+        case physics::Riemann::HLL:
+            flux_kernel = physics::compute_fluxes<physics::Riemann::HLL>;
+            break;
+        case physics::Riemann::HLLC:
+            flux_kernel = physics::compute_fluxes<physics::Riemann::HLLC>;
+            break;
+        default: throw std::invalid_argument("Unknown Riemann solver.");
+    }
+}
+
+/**
+ * @brief Projects a gradient onto a cell-to-face distance.
+ */
+static inline double project(const std::array<double, 3>& g,
+                             const std::array<double, 3>& d) {
+    return g[0] * d[0] + g[1] * d[1] + g[2] * d[2];
+}
+
+/**
+ * @brief MUSCL reconstruction from the stored gradients, with the limiter
+ *        called through `limiter`.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+static void muscl_reconstruction(Simulation& sim) {
+    const Mesh& mesh = sim.mesh;
+    const Connectivity& csr = mesh.csr;
+    Fields& fields = sim.fields;
+
+    #pragma omp parallel for
+    for (int i = 0; i < mesh.n_elements; ++i) {
+        const int begin = csr.begin(i);
+        const int end = csr.end(i);
+
+        for (int v = 0; v < 5; ++v) {
+            const double W = fields.W(i, v);
+            const auto& g = fields.gradW(i, v);
+
+            double Wmin = W;
+            double Wmax = W;
+            for (int s = begin; s < end; ++s) {
+                const int n = csr.neighbors[s];
+                if (n < 0) continue;
+                Wmax = std::max(Wmax, fields.W(n, v));
+                Wmin = std::min(Wmin, fields.W(n, v));
+            }
+
+            const double Dmax = Wmax - W;
+            const double Dmin = Wmin - W;
+
+            double alpha = 1.0;
+            for (int s = begin; s < end; ++s) {
+                const double Df = project(g, csr.df[s]);
+                if ((Df >= 0.0 && Dmax < 1.0e-5) ||
+                    (Df <= 0.0 && Dmin > -1.0e-5)) {
+                    alpha = 0.0;
+                    break;
+                }
+                const double rf = (Df > 0.0) ? Df / Dmax : Df / Dmin;
+                alpha = std::min(alpha, limiter(rf));
+            }
+
+            for (int s = begin; s < end; ++s) {
+                fields.Wf(s, v) = W + alpha * project(g, csr.df[s]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief One stage using the unfused reconstruction.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+static void unfused_stage(Simulation& sim) {
+    if (sim.input.numerical.reconstruction == math::Reconstruction::MUSCL) {
+        gradient_kernel(sim);
+        muscl_reconstruction(sim);
+    } else {
+        math::constant_reconstruction(sim);
+    }
+
+    flux_kernel(sim);
+    physics::apply_boundary_conditions(sim);
+
+    math::advance_solution(sim);
+
+    physics::apply_corrections(sim);
+}
+
+/**
+ * @brief Runs a number of iterations and returns the elapsed time.
+ *
+ * @param sim Reference to the Simulation object.
+ * @param stage Stage function to use.
+ * @param iterations Number of iterations.
+ * @return Elapsed wall time in seconds.
+ */
+static double run(Simulation& sim, StageFunction stage, int iterations) {
+    const int stages = sim.input.numerical.time_stages;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int iter = 0; iter < iterations; ++iter) {
+        sim.fields.prepare_solution_update();
+
+        physics::update_timestep(sim);
+        physics::update_sources(sim);
+
+        for (int s = 0; s < stages; ++s) {
+            stage(sim);
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(end - start).count();
+}
+
+/**
+ * @brief Copies the conservative variables of all elements.
+ */
+static std::vector<double> snapshot(const Simulation& sim) {
+    std::vector<double> W(sim.mesh.n_elements * 5);
+    for (int i = 0; i < sim.mesh.n_elements; ++i)
+        for (int v = 0; v < 5; ++v)
+            W[i * 5 + v] = sim.fields.W(i, v);
+    return W;
+}
+
+/**
+ * @brief Restores the conservative variables of all elements.
+ */
+static void restore(Simulation& sim, const std::vector<double>& W) {
+    for (int i = 0; i < sim.mesh.n_elements; ++i)
+        for (int v = 0; v < 5; ++v)
+            sim.fields.W(i, v) = W[i * 5 + v];
+    sim.fields.update_primitives();
+    sim.status.time = 0.0;
+}
+
+/**
+ * @brief Benchmark entry point.
+ *
+ * @param argc Number of CLI arguments.
+ * @param argv CLI argument values.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on error.
+ */
+int main(int argc, char* argv[]) {
+    Simulation sim;
+
+    try {
+        if (argc < 2 || argc > 3) {
+            throw std::invalid_argument(
+                "Usage: eulercpp_bench_reconstruction <input file> [iterations]"
+            );
+        }
+        const int iterations = (argc == 3) ? std::stoi(argv[2]) : 100;
+
+        load_input(sim.input, 2, argv);
+        read_mesh(sim);
+        preprocess(sim);
+        init_unfused(sim);
+
+        const std::vector<double> W0 = snapshot(sim);
+        std::vector<double> W_unfused, W_fused;
+
+        const int rounds = 3;
+        double t_unfused = 1.0e300;
+        double t_fused = 1.0e300;
+        for (int r = 0; r < rounds; ++r) {
+            restore(sim, W0);
+            t_unfused = std::min(t_unfused,
+                                 run(sim, unfused_stage, iterations));
+            W_unfused = snapshot(sim);
+
+            restore(sim, W0);
+            t_fused = std::min(t_fused, run(sim, run_stage, iterations));
+            W_fused = snapshot(sim);
+        }
+
+        double diff = 0.0;
+        for (std::size_t k = 0; k < W0.size(); ++k) {
+            diff = std::max(diff, std::abs(W_unfused[k] - W_fused[k]));
+        }
+
+        Logger::info() << "Iterations:  " << iterations;
+        Logger::info() << "Unfused:     "
+                       << 1.0e3 * t_unfused / iterations << " ms/iter";
+        Logger::info() << "Fused:       "
+                       << 1.0e3 * t_fused / iterations << " ms/iter";
+        Logger::info() << "Speedup:     " << t_unfused / t_fused;
+        Logger::info() << "Max difference: " << diff;
+
+    } catch (const std::exception& e) {
+        Logger::error() << e.what();
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -34,6 +34,9 @@
 #include <map>
 #include <string>
 
+#include <eulercpp/mesh/gmsh.hpp>
+#include <eulercpp/mesh/renumbering.hpp>
+
 namespace eulercpp {
 
 struct Input;
@@ -45,6 +48,15 @@ struct Input;
 struct MeshSettings {
     std::string mesh_file;      /**< Mesh file path. */
     double min_volume = 0.0;    /**< Minimum allowed cell volume. */
+
+    /** Element renumbering strategy. */
+    Renumbering renumbering = Renumbering::NONE;
+
+    /** Reader of Gmsh 2.2 ASCII mesh files. */
+    MeshReader reader = MeshReader::MAPPED;
+
+    /** Load and store the preprocessed mesh in `<mesh_file>.cache`. */
+    bool cache = false;
 };
 
 /**
@@ -56,6 +68,11 @@ struct MeshSettings {
  * Specifically, it looks for:
  * - "mesh_file" : Path or name of the mesh input file.
  * - "min_volume": Minimum allowed volume in the mesh.
+ * - "renumbering": Element renumbering (0 = none, 1 = RCM, 2 = Hilbert,
+ *                  3 = Morton).
+ * - "mesh_reader": Mesh file reader (0 = serial stream, 1 = parallel
+ *                  memory-mapped), used for Gmsh 2.2 ASCII files.
+ * - "mesh_cache": Preprocessed mesh cache (0 = off, default, 1 = on).
  *
  * @param config A map containing all configuration keys and their string values.
  * @param input  Input structure to update with mesh parameters.
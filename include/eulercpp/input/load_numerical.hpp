@@ -35,8 +35,12 @@
 #include <string>
 #include <vector>
 
+#include <eulercpp/math/block_sparse.hpp>
+#include <eulercpp/math/gradients.hpp>
 #include <eulercpp/math/limiters.hpp>
+#include <eulercpp/math/multigrid.hpp>
 #include <eulercpp/math/reconstruction.hpp>
+#include <eulercpp/math/solution_update.hpp>
 #include <eulercpp/physics/riemann.hpp>
 
 namespace eulercpp {
@@ -51,16 +55,41 @@ struct Numerical {
     /** Reconstruction scheme. */
     math::Reconstruction reconstruction = math::Reconstruction::CONSTANT;
 
+    /** Gradient method. */
+    math::Gradient gradient = math::Gradient::LEAST_SQUARES;
+
     /** Limiter function. */
     math::Limiter limiter = math::Limiter::MINMOD;
 
     /** Riemann solver. */
     physics::Riemann riemann = physics::Riemann::HLLC;
 
+    /** Time integration scheme. */
+    math::TimeIntegration time_integration = math::TimeIntegration::EXPLICIT;
+
     int time_stages = 1;    /**< Number of stages for multi-stage time integration scheme. */
     std::vector<double> a;  /**< Multi-stage coefficients. */
     double CFL = 0.8;       /**< CFL condition number for time stepping. */
+    double CFL_max = 1.0e4; /**< Largest CFL number of the CFL ramp. */
+    bool cfl_ramp = false;  /**< Adaptive CFL number (SER controller). */
     double maxtime = 1.0;   /**< Maximum simulation time. */
+    bool local_timestep = false;  /**< Per-cell time steps (steady state). */
+
+    /** Preconditioner of the Newton-Krylov linear systems. */
+    math::Preconditioner preconditioner = math::Preconditioner::ILU0;
+
+    int krylov_dim = 30;        /**< Largest Krylov subspace (GMRES). */
+    double krylov_tol = 1.0e-2; /**< Relative tolerance of GMRES. */
+
+    double residual_smoothing = 0.0;    /**< Smoothing coefficient (0 = off). */
+    int smoothing_sweeps = 2;           /**< Jacobi sweeps of the smoothing. */
+
+    int multigrid_levels = 0;   /**< Coarse multigrid levels (0 = off). */
+    math::Cycle multigrid_cycle = math::Cycle::V;   /**< Multigrid cycle. */
+
+    int snapshot_delay = 0;     /**< Iterations between snapshots (0 = off). */
+    int rollback_attempts = 3;  /**< Rollbacks allowed per snapshot. */
+
     int maxiter = 1e3;      /**< Maximum number of iterations. */
 };
 
@@ -0,0 +1,114 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file block_sparse.hpp
+ * @brief 5x5 block compressed-sparse-row matrices and preconditioners.
+ *
+ * Cell-coupled Jacobians have one 5x5 block per cell and per interior
+ * neighbor. `BlockCSR` stores them row by row with sorted column indices,
+ * with the sparsity pattern taken from the mesh connectivity. Block-Jacobi
+ * and block ILU(0) factorizations are provided as preconditioners.
+ *
+ * @author Alessio Improta
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+namespace eulercpp {
+    struct Connectivity;
+}
+
+namespace eulercpp::math {
+
+/**
+ * @brief Dense 5x5 block, row major.
+ */
+using Block = std::array<double, 25>;
+
+/**
+ * @enum Preconditioner
+ * @brief Supported block preconditioners.
+ */
+enum class Preconditioner {
+    BLOCK_JACOBI,   /**< Inverse of the diagonal blocks */
+    ILU0            /**< Block incomplete LU without fill-in */
+};
+
+/**
+ * @struct BlockCSR
+ * @brief Sparse matrix of 5x5 blocks in compressed-sparse-row format.
+ *
+ * The blocks of row i occupy offsets[i] to offsets[i+1]-1, in increasing
+ * column order. `slot_block` maps every connectivity slot to the block
+ * coupling the element with its neighbor (-1 on boundary slots), so that
+ * assembly loops over faces without searching.
+ */
+struct BlockCSR {
+    int n_rows = 0;                 /**< Number of block rows. */
+    std::vector<int> offsets;       /**< First block of each row (n+1). */
+    std::vector<int> columns;       /**< Block column indices. */
+    std::vector<int> diagonal;      /**< Diagonal block of each row. */
+    std::vector<int> slot_block;    /**< Off-diagonal block of each slot. */
+    std::vector<Block> blocks;      /**< Block values. */
+
+    /**
+     * @brief Builds the sparsity pattern from the mesh connectivity.
+     * @param csr Element-to-face connectivity.
+     * @param n_elements Number of elements.
+     */
+    void build(const Connectivity& csr, int n_elements);
+
+    /**
+     * @brief Sets all blocks to zero, keeping the pattern.
+     */
+    void zero();
+};
+
+/**
+ * @brief Factorizes a block matrix in place.
+ *
+ * Block-Jacobi replaces the diagonal blocks with their inverses. ILU(0)
+ * overwrites the strictly lower blocks with L (unit diagonal implied) and
+ * the upper blocks with U, restricted to the sparsity pattern, and stores
+ * the inverses of the diagonal blocks of U.
+ *
+ * @param A Matrix to factorize.
+ * @param type Preconditioner type.
+ * @throws physics::FloatingPointError if a diagonal block is singular or
+ *         not finite.
+ */
+void factorize(BlockCSR& A, Preconditioner type);
+
+/**
+ * @brief Applies a factorized preconditioner: x = M^-1 r.
+ *
+ * @param M Matrix factorized by `factorize` with the same type.
+ * @param type Preconditioner type.
+ * @param r Right-hand side, five entries per row.
+ * @param x Solution, five entries per row.
+ */
+void precondition(const BlockCSR& M, Preconditioner type,
+                  const double* r, double* x);
+
+} // namespace eulercpp::math
@@ -40,17 +40,34 @@ namespace eulercpp {
 namespace eulercpp::math {
 
 /**
- * @brief Compute gradients of conserved variables in a simulation.
+ * @enum Gradient
+ * @brief Supported gradient reconstruction methods.
+ *
+ * Both methods are evaluated as `sum_f c_f * (W_neighbor - W_cell)`.
+ * Least squares reads `c_f` from `Connectivity::c`; Green-Gauss forms
+ * `c_f = sign_f * A_f * n_f / (2 V)` from the unique face area vectors,
+ * so that no per-slot coefficients are stored.
+ */
+enum class Gradient {
+    LEAST_SQUARES, /**< Weighted least-squares gradient */
+    GREEN_GAUSS    /**< Green-Gauss gradient with face-averaged values */
+};
+
+/**
+ * @brief Compute gradients of conserved variables for a fixed dimension.
  *
  * Computes the gradients of all variables stored in `sim.fields.W`
  * for every element of the mesh. Gradients are calculated using
- * neighboring elements and face-weight vectors and stored in
- * `sim.fields.gradW`.
+ * neighboring elements and precomputed gradient coefficients, and
+ * stored in `sim.fields.gradW`. The loops over spatial directions are
+ * unrolled at compile time.
  *
+ * @tparam Dim Spatial dimension (1, 2 or 3).
  * @param sim Reference to the Simulation containing mesh and fields.
  *
  * @note The computation is parallelized over mesh elements using OpenMP.
  */
+template <int Dim>
 void compute_gradients(eulercpp::Simulation& sim);
 
 } // namespace eulercpp::math
@@ -26,7 +26,7 @@
  * Variation Diminishing) schemes and other second-order reconstructions.
  * It provides both the enumeration of limiter types and their corresponding
  * inline implementations. A function is provided to map a limiter type to
- * its function pointer.
+ * its function pointer, and `limit<L>` selects a limiter at compile time.
  *
  * Available limiters:
  * - Minmod
@@ -144,6 +144,26 @@ inline double modified_venkatakrishnan(double rf) {
            (rf * (rf * (2.0 * rf + 1.0) + 1.0) + 1.0);
 }
 
+/**
+ * @brief Limiter function selected at compile time.
+ *
+ * Unlike the function pointer returned by `get_limiter`, this call can be
+ * inlined in the reconstruction loops.
+ *
+ * @tparam L Limiter type.
+ * @param rf The ratio of differences used in the reconstruction.
+ * @return The limited value.
+ */
+template <Limiter L>
+inline double limit(double rf) {
+    if constexpr (L == Limiter::MINMOD)             return minmod(rf);
+    else if constexpr (L == Limiter::SUPERBEE)      return superbee(rf);
+    else if constexpr (L == Limiter::VANLEER)       return vanleer(rf);
+    else if constexpr (L == Limiter::VENKATAKRISHNAN)
+        return venkatakrishnan(rf);
+    else return modified_venkatakrishnan(rf);
+}
+
 /**
  * @brief Type alias for a limiter function.
  *
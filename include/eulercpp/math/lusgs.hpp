@@ -0,0 +1,53 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file lusgs.hpp
+ * @brief Matrix-free LU-SGS implicit time integration.
+ *
+ * Implicit backward Euler step for steady-state problems, with the flux
+ * Jacobians approximated by a first-order Rusanov splitting and the
+ * linear system solved by one lower-upper symmetric Gauss-Seidel sweep.
+ *
+ * @author Alessio Improta
+ */
+
+#pragma once
+
+namespace eulercpp {
+    struct Simulation;
+}
+
+namespace eulercpp::math {
+
+/**
+ * @brief Advances the solution by one implicit LU-SGS step.
+ *
+ * Solves `(D + L) D^-1 (D + U) dW = b`, where `b` is the residual of the
+ * current fluxes and sources, with one forward and one backward sweep
+ * over the cells in their (possibly renumbered) order. Local time steps
+ * `fields.dt(i)` must be up to date. The increment is applied with
+ * `apply_increment`.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void lusgs_update(Simulation& sim);
+
+} // namespace eulercpp::math
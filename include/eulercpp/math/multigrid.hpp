@@ -0,0 +1,73 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file multigrid.hpp
+ * @brief Agglomeration multigrid acceleration for steady-state runs.
+ *
+ * Coarse levels are built by fusing each element with its free
+ * face-neighbors, using only the face graph, so any polygon or
+ * polyhedron mesh is supported. Each cycle restricts the solution
+ * (volume average) and the residual (sum), and runs full approximation
+ * storage (FAS) V or W cycles smoothed by the multi-stage Runge-Kutta
+ * scheme on a first-order Rusanov discretization of the coarse levels.
+ *
+ * @author Alessio Improta
+ */
+
+#pragma once
+
+namespace eulercpp {
+    struct Simulation;
+}
+
+namespace eulercpp::math {
+
+/**
+ * @enum Cycle
+ * @brief Supported multigrid cycles.
+ */
+enum class Cycle {
+    V,  /**< One coarse-level visit per cycle */
+    W   /**< Two coarse-level visits per cycle */
+};
+
+/**
+ * @brief Builds the coarse levels from the mesh connectivity.
+ *
+ * Agglomeration stops early if a level has no interior faces left.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void init_multigrid(const Simulation& sim);
+
+/**
+ * @brief Runs one FAS cycle on the coarse levels.
+ *
+ * Called after the fine-level Runge-Kutta iteration. The fine residual
+ * is evaluated at the current solution, the coarse corrections are
+ * injected back, and cells whose corrected state would be unphysical
+ * keep their fine-level value.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void multigrid_cycle(Simulation& sim);
+
+} // namespace eulercpp::math
@@ -0,0 +1,55 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file newton_krylov.hpp
+ * @brief Jacobian-free Newton-Krylov time integration.
+ *
+ * Pseudo-transient Newton iteration for steady-state problems. Each step
+ * solves `(V/dt + dR/dW) dW = b` with preconditioned GMRES, where the
+ * Jacobian-vector products are finite differences of the full residual
+ * pipeline and the preconditioner is a first-order Rusanov Jacobian
+ * stored in a 5x5 block-CSR matrix.
+ *
+ * @author Alessio Improta
+ */
+
+#pragma once
+
+namespace eulercpp {
+    struct Simulation;
+}
+
+namespace eulercpp::math {
+
+/**
+ * @brief Advances the solution by one Newton-Krylov step.
+ *
+ * Requires the fluxes of the current solution (see `run_stage`) and up
+ * to date local time steps. Large CFL numbers are reached through the
+ * CFL controller (`physics::update_cfl`), enabled by default with this
+ * scheme.
+ *
+ * @param sim Reference to the Simulation object.
+ * @throws physics::FloatingPointError if the preconditioner is singular.
+ */
+void newton_krylov_update(Simulation& sim);
+
+} // namespace eulercpp::math
@@ -29,9 +29,8 @@
  * - CONSTANT: piecewise constant reconstruction.
  * - MUSCL   : Monotone Upstream-Centered Scheme for Conservation Laws.
  *
- * Users can select a reconstruction scheme and a limiter type for MUSCL.
- * The header declares the public interface for initializing and applying
- * reconstruction.
+ * The scheme, limiter and dimension are selected at compile time; the
+ * instantiations are chosen by `init_pipeline`.
  *
  * @author Alessio Improta
  */
@@ -56,37 +55,27 @@ enum class Reconstruction {
 };
 
 /**
- * @brief Function pointer type for reconstruction schemes.
- */
-using ReconstructionScheme = void(*)(eulercpp::Simulation&);
-
-/**
- * @brief Applies the current reconstruction scheme to a simulation.
- *
- * Calls the function pointer set by `init_reconstruction`.
- *
- * @param sim Simulation object to apply reconstruction to.
- */
-void reconstruction(eulercpp::Simulation& sim);
-
-/**
- * @brief Initializes the reconstruction scheme.
+ * @brief Piecewise constant reconstruction.
  *
- * Maps the `Reconstruction` enum to the corresponding internal function.
+ * Sets face values equal to the owner cell values.
  *
- * @param scheme Selected reconstruction scheme.
- * @throws std::invalid_argument if the scheme is unknown.
+ * @param sim Simulation object to update.
  */
-void init_reconstruction(Reconstruction scheme);
+void constant_reconstruction(eulercpp::Simulation& sim);
 
 /**
- * @brief Initializes the limiter function for MUSCL reconstruction.
+ * @brief Fused gradient and MUSCL reconstruction, with limiter and
+ *        dimension selected at compile time.
  *
- * Must be called before using MUSCL reconstruction to ensure the limiter
- * function is set.
+ * Equivalent to `compute_gradients` followed by a limited MUSCL
+ * reconstruction, but neighbor states are read once per cell and the
+ * gradients are not stored in `Fields`.
  *
- * @param type Limiter type.
+ * @tparam L Limiter type.
+ * @tparam Dim Spatial dimension (1, 2 or 3).
+ * @param sim Simulation object to update.
  */
-void init_limiter(Limiter type);
+template <Limiter L, int Dim>
+void fused_muscl_reconstruction(eulercpp::Simulation& sim);
 
 } // namespace eulercpp::math
@@ -0,0 +1,132 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file reduction.hpp
+ * @brief Deterministic parallel reductions over cells or faces.
+ *
+ * OpenMP reductions combine thread partials in an unspecified order, so
+ * floating-point sums change with the number of threads. The reductions
+ * in this file split the index range into fixed blocks of
+ * `reduction_block` entries, accumulate each block serially in index
+ * order (blocks are distributed over threads), and combine the block
+ * partials pairwise in a fixed tree. The result only depends on the
+ * range length, never on the number of threads or the schedule.
+ *
+ * @author Alessio Improta
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+namespace eulercpp::math {
+
+/** @brief Number of entries accumulated serially per block. */
+constexpr int reduction_block = 512;
+
+/**
+ * @brief Combines block partials pairwise, in a fixed tree.
+ *
+ * @param partials Pointer to the first partial.
+ * @param n Number of partials (at least one).
+ * @param combine Operation merging its second argument into the first.
+ * @return Combined value.
+ */
+template <typename T, typename Combine>
+T combine_pairwise(const T* partials, int n, Combine& combine) {
+    if (n == 1) return partials[0];
+    const int half = n / 2;
+    T left = combine_pairwise(partials, half, combine);
+    const T right = combine_pairwise(partials + half, n - half, combine);
+    combine(left, right);
+    return left;
+}
+
+/**
+ * @brief Deterministic blocked reduction over the range [0, n).
+ *
+ * `kernel(i, acc)` is called for every index, in increasing order within
+ * each block, and may have side effects on entry `i`. Must be called
+ * outside of a parallel region.
+ *
+ * @param n Number of entries.
+ * @param identity Neutral element of the reduction.
+ * @param kernel Operation accumulating entry `i` into `acc`.
+ * @param combine Operation merging its second argument into the first.
+ * @return Reduced value, bitwise independent of the number of threads.
+ */
+template <typename T, typename Kernel, typename Combine>
+T blocked_reduce(int n, const T& identity, Kernel&& kernel,
+                 Combine&& combine) {
+    const int n_blocks = (n + reduction_block - 1) / reduction_block;
+    if (n_blocks == 0) return identity;
+
+    std::vector<T> partials(n_blocks, identity);
+
+    #pragma omp parallel for schedule(static)
+    for (int block = 0; block < n_blocks; ++block) {
+        const int begin = block * reduction_block;
+        const int end = std::min(n, begin + reduction_block);
+        T acc = identity;
+        for (int i = begin; i < end; ++i) {
+            kernel(i, acc);
+        }
+        partials[block] = acc;
+    }
+
+    return combine_pairwise(partials.data(), n_blocks, combine);
+}
+
+/**
+ * @brief Deterministic blocked sum of `term(i)` over [0, n).
+ *
+ * @param n Number of entries.
+ * @param term Function returning the contribution of entry `i`.
+ * @return Sum, bitwise independent of the number of threads.
+ */
+template <typename Term>
+double blocked_sum(int n, Term&& term) {
+    return blocked_reduce(
+        n, 0.0,
+        [&](int i, double& acc) { acc += term(i); },
+        [](double& a, const double& b) { a += b; }
+    );
+}
+
+/**
+ * @brief Blocked maximum of `term(i)` over [0, n).
+ *
+ * @param n Number of entries.
+ * @param identity Value returned for an empty range.
+ * @param term Function returning the value of entry `i`.
+ * @return Maximum value.
+ */
+template <typename Term>
+double blocked_max(int n, double identity, Term&& term) {
+    return blocked_reduce(
+        n, identity,
+        [&](int i, double& acc) { acc = std::max(acc, term(i)); },
+        [](double& a, const double& b) { a = std::max(a, b); }
+    );
+}
+
+} // namespace eulercpp::math
@@ -0,0 +1,201 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file simd.hpp
+ * @brief Minimal SIMD vector types for batched numerical kernels.
+ *
+ * This header provides small wrappers around packed double-precision
+ * registers with a common interface (arithmetic operators, min/max, abs,
+ * sqrt, comparisons and masked selection), so that a kernel written once
+ * as a template can be instantiated for:
+ * - Scalar: one lane, portable fallback.
+ * - AVX2  : four lanes (`__m256d`), available when compiled with AVX2.
+ * - AVX512: eight lanes (`__m512d`), available when compiled with AVX-512F.
+ *
+ * `Native` is the widest type enabled by the compiler flags (see the
+ * EULERCPP_SIMD CMake option). The kernels use no explicit fused
+ * multiply-add, but results are not bit-identical across types: the
+ * compiler may contract scalar code into FMAs, and `min`/`max` follow
+ * the instruction semantics for NaN operands rather than `std::min`/
+ * `std::max`.
+ *
+ * @author Alessio Improta
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace eulercpp::math::simd {
+
+/**
+ * @struct Scalar
+ * @brief Single-lane fallback with the SIMD interface.
+ */
+struct Scalar {
+    static constexpr int width = 1; /**< Number of lanes */
+    using mask = bool;              /**< Lane mask type */
+
+    double v; /**< Value */
+
+    Scalar() = default;
+    Scalar(double x) : v(x) {}
+
+    /** @brief Load one value. */
+    static inline Scalar load(const double* p) noexcept { return Scalar(*p); }
+
+    /** @brief Store one value. */
+    inline void store(double* p) const noexcept { *p = v; }
+};
+
+inline Scalar operator+(Scalar a, Scalar b) noexcept { return a.v + b.v; }
+inline Scalar operator-(Scalar a, Scalar b) noexcept { return a.v - b.v; }
+inline Scalar operator*(Scalar a, Scalar b) noexcept { return a.v * b.v; }
+inline Scalar operator/(Scalar a, Scalar b) noexcept { return a.v / b.v; }
+inline Scalar min(Scalar a, Scalar b) noexcept { return std::min(a.v, b.v); }
+inline Scalar max(Scalar a, Scalar b) noexcept { return std::max(a.v, b.v); }
+inline Scalar abs(Scalar a) noexcept { return std::abs(a.v); }
+inline Scalar sqrt(Scalar a) noexcept { return std::sqrt(a.v); }
+inline bool gt(Scalar a, Scalar b) noexcept { return a.v > b.v; }
+inline bool lt(Scalar a, Scalar b) noexcept { return a.v < b.v; }
+
+/** @brief Returns a where the mask is set, b elsewhere. */
+inline Scalar select(bool m, Scalar a, Scalar b) noexcept {
+    return m ? a : b;
+}
+
+#if defined(__AVX2__)
+/**
+ * @struct AVX2
+ * @brief Four-lane double-precision vector (AVX2).
+ */
+struct AVX2 {
+    static constexpr int width = 4; /**< Number of lanes */
+    using mask = __m256d;           /**< Lane mask type */
+
+    __m256d v; /**< Packed values */
+
+    AVX2() = default;
+    AVX2(__m256d x) : v(x) {}
+    AVX2(double x) : v(_mm256_set1_pd(x)) {}
+
+    /** @brief Load four aligned values. */
+    static inline AVX2 load(const double* p) noexcept {
+        return _mm256_load_pd(p);
+    }
+
+    /** @brief Store four aligned values. */
+    inline void store(double* p) const noexcept { _mm256_store_pd(p, v); }
+};
+
+inline AVX2 operator+(AVX2 a, AVX2 b) noexcept { return _mm256_add_pd(a.v, b.v); }
+inline AVX2 operator-(AVX2 a, AVX2 b) noexcept { return _mm256_sub_pd(a.v, b.v); }
+inline AVX2 operator*(AVX2 a, AVX2 b) noexcept { return _mm256_mul_pd(a.v, b.v); }
+inline AVX2 operator/(AVX2 a, AVX2 b) noexcept { return _mm256_div_pd(a.v, b.v); }
+inline AVX2 min(AVX2 a, AVX2 b) noexcept { return _mm256_min_pd(a.v, b.v); }
+inline AVX2 max(AVX2 a, AVX2 b) noexcept { return _mm256_max_pd(a.v, b.v); }
+inline AVX2 abs(AVX2 a) noexcept {
+    return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v);
+}
+inline AVX2 sqrt(AVX2 a) noexcept { return _mm256_sqrt_pd(a.v); }
+inline __m256d gt(AVX2 a, AVX2 b) noexcept {
+    return _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ);
+}
+inline __m256d lt(AVX2 a, AVX2 b) noexcept {
+    return _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ);
+}
+
+/** @brief Returns a where the mask is set, b elsewhere. */
+inline AVX2 select(__m256d m, AVX2 a, AVX2 b) noexcept {
+    return _mm256_blendv_pd(b.v, a.v, m);
+}
+#endif
+
+#if defined(__AVX512F__)
+/**
+ * @struct AVX512
+ * @brief Eight-lane double-precision vector (AVX-512F).
+ */
+struct AVX512 {
+    static constexpr int width = 8; /**< Number of lanes */
+    using mask = __mmask8;          /**< Lane mask type */
+
+    __m512d v; /**< Packed values */
+
+    AVX512() = default;
+    AVX512(__m512d x) : v(x) {}
+    AVX512(double x) : v(_mm512_set1_pd(x)) {}
+
+    /** @brief Load eight aligned values. */
+    static inline AVX512 load(const double* p) noexcept {
+        return _mm512_load_pd(p);
+    }
+
+    /** @brief Store eight aligned values. */
+    inline void store(double* p) const noexcept { _mm512_store_pd(p, v); }
+};
+
+inline AVX512 operator+(AVX512 a, AVX512 b) noexcept { return _mm512_add_pd(a.v, b.v); }
+inline AVX512 operator-(AVX512 a, AVX512 b) noexcept { return _mm512_sub_pd(a.v, b.v); }
+inline AVX512 operator*(AVX512 a, AVX512 b) noexcept { return _mm512_mul_pd(a.v, b.v); }
+inline AVX512 operator/(AVX512 a, AVX512 b) noexcept { return _mm512_div_pd(a.v, b.v); }
+
+/// min, max and sqrt use the full-mask forms: the unmasked intrinsics of
+/// some GCC versions merge into an undefined vector and raise spurious
+/// -Wuninitialized warnings; the generated instructions are the same.
+inline AVX512 min(AVX512 a, AVX512 b) noexcept {
+    return _mm512_mask_min_pd(a.v, 0xFF, a.v, b.v);
+}
+inline AVX512 max(AVX512 a, AVX512 b) noexcept {
+    return _mm512_mask_max_pd(a.v, 0xFF, a.v, b.v);
+}
+inline AVX512 abs(AVX512 a) noexcept { return _mm512_abs_pd(a.v); }
+inline AVX512 sqrt(AVX512 a) noexcept {
+    return _mm512_mask_sqrt_pd(a.v, 0xFF, a.v);
+}
+inline __mmask8 gt(AVX512 a, AVX512 b) noexcept {
+    return _mm512_cmp_pd_mask(a.v, b.v, _CMP_GT_OQ);
+}
+inline __mmask8 lt(AVX512 a, AVX512 b) noexcept {
+    return _mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ);
+}
+
+/** @brief Returns a where the mask is set, b elsewhere. */
+inline AVX512 select(__mmask8 m, AVX512 a, AVX512 b) noexcept {
+    return _mm512_mask_blend_pd(m, b.v, a.v);
+}
+#endif
+
+/** @brief Widest SIMD type enabled by the compiler flags. */
+#if defined(__AVX512F__)
+using Native = AVX512;
+#elif defined(__AVX2__)
+using Native = AVX2;
+#else
+using Native = Scalar;
+#endif
+
+} // namespace eulercpp::math::simd
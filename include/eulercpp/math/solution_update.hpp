@@ -32,23 +32,76 @@
 
 #pragma once
 
+#include <vector>
+
 namespace eulercpp {
     struct Simulation;
 }
 
 namespace eulercpp::math {
 
+/**
+ * @enum TimeIntegration
+ * @brief Supported time integration schemes.
+ */
+enum class TimeIntegration {
+    EXPLICIT,       /**< Explicit multi-stage scheme */
+    LUSGS,          /**< Matrix-free implicit LU-SGS (steady state) */
+    NEWTON_KRYLOV   /**< Jacobian-free Newton-Krylov (steady state) */
+};
+
 /**
  * @brief Advances the simulation solution by one time step/stage.
  *
  * This function updates the conservative variables of the simulation
  * based on the numerical fluxes and source terms. It supports multi-stage
  * time integration methods, using an internal counter to select the
- * appropriate stage coefficient.
+ * appropriate stage coefficient. With local time stepping each cell
+ * advances with its own time step `fields.dt(i)` instead of `status.dt`.
+ *
+ * The update is a single pass over the cells: each cell gathers its
+ * fluxes, updates W, refreshes its primitive cache, accumulates the
+ * L1/L2/Linf residual norms and, if the new state is unphysical, is
+ * added to `fields.unphysical_cells()` for `physics::apply_corrections`.
+ * Norms are reduced with `blocked_reduce`, so they do not depend on the
+ * number of threads. With implicit residual smoothing enabled, the pass
+ * is split around `smooth_residual` and the norms are those of the
+ * unsmoothed residual.
  *
  * @param sim Reference to the Simulation object containing
  *            mesh, fields, and numerical parameters.
  */
 void advance_solution(Simulation& sim);
 
+/**
+ * @brief Restarts multi-stage integration from the first stage.
+ *
+ * Needed when an iteration is abandoned midway, e.g. on rollback.
+ */
+void reset_stage_counter();
+
+/**
+ * @brief Applies a solution increment computed by an implicit scheme.
+ *
+ * Adds `dW` (five entries per cell, cell by cell) to the conservative
+ * variables, refreshes the primitive cache, accumulates the residual
+ * norms of `fields.b` and collects the unphysical cells, as
+ * `advance_solution` does for the explicit scheme.
+ *
+ * @param sim Reference to the Simulation object.
+ * @param dW Solution increment.
+ */
+void apply_increment(Simulation& sim, const std::vector<double>& dW);
+
+/**
+ * @brief Gathers the right-hand side `S - sum(sign F)` of all cells.
+ *
+ * Uses the current sources and unique-face fluxes. Non-finite entries
+ * are replaced by zero, as in `advance_solution`.
+ *
+ * @param sim Reference to the Simulation object.
+ * @param b Output vector, five entries per cell, cell by cell.
+ */
+void gather_rhs(const Simulation& sim, std::vector<double>& b);
+
 } // namespace eulercpp::math
@@ -0,0 +1,89 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file connectivity.hpp
+ * @brief Defines the compressed-sparse-row element connectivity.
+ *
+ * This header provides the Connectivity struct, which stores the
+ * element-to-face relations and the per-face geometric data used by the
+ * solver kernels in flat, contiguous arrays.
+ *
+ * @author Alessio Improta
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+namespace eulercpp {
+
+/**
+ * @struct Connectivity
+ * @brief Element-to-face connectivity in compressed-sparse-row format.
+ *
+ * The faces of element i occupy the slots offsets[i] to offsets[i+1]-1
+ * of every per-slot array, in the local face order of the element. All
+ * per-slot arrays are contiguous, so that the solver loops over an
+ * element's faces without chasing per-element heap allocations.
+ *
+ * Half-faces are numbered from the same exclusive prefix sum, so the
+ * slot index is also the index of the half-face in Mesh::faces.
+ *
+ * Least-squares gradients use the per-slot coefficients c. Green-Gauss
+ * gradients leave d and c empty and use the area vector of each unique
+ * face (left orientation) and the element volumes instead.
+ */
+struct Connectivity {
+    std::vector<int> offsets;   /**< First slot of each element (n+1). */
+    std::vector<int> neighbors; /**< Neighbor element (-1 on boundary). */
+    std::vector<int> unique;    /**< Unique face index of each slot. */
+    std::vector<double> sign;   /**< Unique flux orientation (+1/-1). */
+    int max_faces = 0;          /**< Largest number of faces of an element. */
+
+    std::vector<std::array<double, 3>> d;   /**< Distance to neighbor cells. */
+    std::vector<std::array<double, 3>> df;  /**< Distance to face centroids. */
+    std::vector<std::array<double, 3>> c;   /**< Gradient coefficients. */
+
+    /// Green-Gauss geometry, stored instead of d and c
+    std::vector<std::array<double, 3>> area;  /**< Unique face A * n. */
+    std::vector<double> half_inv_volume;      /**< 1 / (2 V) of elements. */
+
+    /**
+     * @brief First slot of an element.
+     * @param i Index of the element
+     * @return Index of the first slot of element i
+     */
+    inline int begin(int i) const noexcept {
+        return offsets[i];
+    }
+
+    /**
+     * @brief One past the last slot of an element.
+     * @param i Index of the element
+     * @return Index one past the last slot of element i
+     */
+    inline int end(int i) const noexcept {
+        return offsets[i + 1];
+    }
+};
+
+} // namespace eulercpp
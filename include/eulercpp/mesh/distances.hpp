@@ -37,6 +37,8 @@
 #include <string>
 #include <vector>
 
+#include <eulercpp/math/gradients.hpp>
+
 namespace eulercpp {
 
 struct Mesh;
@@ -47,18 +49,32 @@ struct Mesh;
  * For each element, this function calculates:
  * - **df**: Vector from element centroid to face centroid.
  * - **d** : Vector from element centroid to neighbor centroid.
- * - **w** : Reconstruction weights based on normalized `d` vectors.
- * - **S** : Inverse of the reconstruction matrix used in gradient
- *           evaluation.
+ * - **c** : Least-squares gradient coefficients `c_f = S * w_f`, where
+ *           `w_f = d / |d|^2` and `S` is the inverse of the
+ *           reconstruction matrix. The gradient of a cell is
+ *           `sum_f c_f * (W_neighbor - W_cell)`.
  *
- * The computation adapts to the specified dimension:
+ * The least-squares matrix adapts to the specified dimension:
  * - **3D**: Full 3x3 reconstruction matrix.
  * - **2D**: 2x2 reconstruction matrix embedded in 3x3.
  * - **1D**: Single scalar reconstruction weight.
  *
+ * For Green-Gauss gradients, d and c are left empty. The area vector
+ * `A_f * n_f` of each unique face and `1 / (2 V)` of each element are
+ * stored instead, and the gradient of a cell is
+ * `sum_f sign_f * A_f * n_f * (W_neighbor - W_cell) / (2 V)`. Since
+ * `sum_f A_f n_f = 0` on a closed cell, this equals the surface integral
+ * of the face averages `(W_cell + W_neighbor) / 2`, with boundary faces
+ * taking the cell value.
+ *
+ * Components beyond the dimension are zero. Face normals and element
+ * volumes must be computed, and not yet scaled for axisymmetry.
+ *
  * @param mesh Reference to the mesh containing elements and faces.
  * @param dimension Input dimension cods as defined in load_physics.hpp.
+ * @param gradient Gradient method the coefficients are built for.
  */
-void compute_distances(Mesh& mesh, const int dimension);
+void compute_distances(Mesh& mesh, const int dimension,
+                       const math::Gradient gradient);
 
 } // namespace eulercpp
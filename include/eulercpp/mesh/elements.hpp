@@ -61,14 +61,25 @@ enum class ElementType {
     POLYHEDRON,     /**< Polyhedral element */
 };
 
+/**
+ * @struct ElementShape
+ * @brief Size of a fixed-size element type.
+ */
+struct ElementShape {
+    int n_nodes;    /**< Number of nodes. */
+    int n_faces;    /**< Number of faces. */
+    int dimension;  /**< Spatial dimension. */
+};
+
 /**
  * @struct Element
  * @brief Represents a single element (cell) in the computational mesh.
  *
  * Each Element contains identifiers, connectivity, geometry, and
  * precomputed properties used during CFD simulation. It stores node
- * indices, face indices, neighbor relationships, volume, centroid,
- * and distances for numerical schemes.
+ * indices, volume and centroid. Face indices, neighbor relationships,
+ * distances and gradient coefficients are stored in the mesh
+ * Connectivity.
  *
  * @note The element type must be set according to the ElementType enum.
  */
@@ -82,21 +93,47 @@ struct Element {
     std::vector<int> nodes; /**< Indices of nodes forming the element. */
 
     int n_faces = 0;            /**< Number of faces forming the element. */
-    std::vector<int> faces;     /**< Indices of faces forming the element. */
-    std::vector<int> neighbors; /**< Indices of neighbor elements. */
 
     double volume = 0.0;                /**< Volume of the element. */
     std::array<double, 3> centroid;     /**< Element centroid. */
 
-    std::vector<std::array<double, 3>> d;   /**< Distance to neighbor cells. */
-    std::vector<std::array<double, 3>> df;  /**< Distance to face centroids. */
-
-    std::vector<std::array<double, 3>> w; /**< Reconstruction weights. */
-    std::array<std::array<double, 3>, 3> S = {0.0}; /**< Inverse S matrix. */
-
     bool boundary = false;    /**< True if the element is a boundary face. */
 };
 
+/**
+ * @brief Returns the shape of a fixed-size element type.
+ *
+ * @param type Element type.
+ * @return Number of nodes, number of faces and dimension of the element.
+ * @throws std::runtime_error If the element type has no fixed size
+ *         (polygons and polyhedra) or is not supported.
+ */
+ElementShape element_shape(ElementType type);
+
+/**
+ * @brief Parses an element line of the `$Elements` section.
+ *
+ * The line holds the element id, type, number of tags, the tags and the
+ * node ids. Polygons list their number of nodes before the nodes, and
+ * polyhedra their number of faces followed by the node count and node
+ * ids of each face. Node ids are converted to zero-based indices.
+ *
+ * @param p Start of the line.
+ * @param end End of the line.
+ * @param elem Element to fill.
+ * @return Position right after the last node id.
+ * @throws std::runtime_error If the line is malformed or the element type
+ *         is not supported.
+ */
+const char* parse_element(const char* p, const char* end, Element& elem);
+
+/**
+ * @brief Logs the number of elements of each type.
+ *
+ * @param mesh Reference to the Mesh containing the elements.
+ */
+void log_elements(const Mesh& mesh);
+
 /**
  * @brief Reads the element data from a mesh file into the mesh structure.
  *
@@ -131,4 +168,16 @@ void read_elements(std::ifstream& file, Mesh& mesh);
  */
 void compute_elements(Mesh& mesh, Input& input);
 
+/**
+ * @brief Removes boundary elements from the mesh.
+ *
+ * Boundary elements only carry boundary tags and are not part of the
+ * computational domain. They are moved out of the mesh before faces are
+ * built, so that element indices stay valid in the face connectivity.
+ *
+ * @param mesh Reference to the Mesh containing the elements.
+ * @return The boundary elements, in file order.
+ */
+std::vector<Element> extract_boundary_elements(Mesh& mesh);
+
 } // namespace eulercpp
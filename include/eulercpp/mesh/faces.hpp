@@ -40,6 +40,8 @@
 namespace eulercpp {
 
 struct Mesh;
+struct Element;
+struct Input;
 
 /**
  * @struct Face
@@ -53,12 +55,15 @@ struct Face {
     int id = -1;                    /**< Unique identifier of the face. */
     int flag = -1;                  /**< Flag for boundary specification. */
 
-    int n_nodes = -1;               /**< Number of nodes defining the face. */
+    /** Number of nodes defining the face (0 if loaded from a mesh cache). */
+    int n_nodes = -1;
     std::vector<int> nodes;         /**< Indices of nodes forming the face. */
 
     int owner = -1;     /**< Index of the element that owns the face. */
     int neighbor = -1;  /**< Index of the adjacent element. */
     int opposite = -1;  /**< Index of the opposite face. */
+    int unique = -1;    /**< Index of the shared unique face. */
+    int sign = 1;       /**< Orientation w.r.t. the unique face (+1/-1). */
 
     double area;                            /**< Area of the face. */
     std::array<double, 3> centroid = {0.0}; /**< Face centroid. */
@@ -67,23 +72,126 @@ struct Face {
     std::array<double, 3> t2 = {0.0};       /**< Second tangent vector. */
 };
 
+/**
+ * @struct UniqueFace
+ * @brief Represents a geometric face shared by two half-faces.
+ *
+ * Every element stores its own copy of each face (half-face). Interior
+ * half-faces come in pairs with opposite normals; a unique face groups
+ * the pair so that the numerical flux is evaluated only once. The left
+ * half-face defines the orientation of the stored flux; boundary unique
+ * faces have no right half-face.
+ */
+struct UniqueFace {
+    int left = -1;      /**< Index of the half-face defining orientation. */
+    int right = -1;     /**< Index of the opposite half-face (-1 if none). */
+    int owner = -1;     /**< Element on the left side. */
+    int neighbor = -1;  /**< Element on the right side (-1 if none). */
+};
+
+/**
+ * @struct FaceKey
+ * @brief Order-independent key of the node set of a face.
+ *
+ * Holds the (up to) four smallest node indices in increasing order,
+ * padded with -1, and the number of nodes. The key identifies the node
+ * set of faces with at most four nodes exactly; faces with more nodes
+ * are compared node by node when their keys match.
+ */
+struct FaceKey {
+    std::array<int, 4> nodes;   /**< Smallest node indices (sorted). */
+    int n_nodes;                /**< Number of nodes of the face. */
+    int face;                   /**< Index of the half-face. */
+};
+
+/**
+ * @struct FaceTable
+ * @brief Half-face keys sorted for matching and lookup.
+ *
+ * Keys are grouped by their smallest node, and sorted by key and then by
+ * face index within each group, so that the half-faces sharing a node set
+ * are adjacent and in face order.
+ */
+struct FaceTable {
+    std::vector<FaceKey> keys;  /**< Sorted keys of all half-faces. */
+    std::vector<int> offsets;   /**< First key of each smallest node. */
+
+    /**
+     * @brief Finds the half-face with a given node set.
+     *
+     * @param nodes Node indices, in any order.
+     * @param n_nodes Number of nodes.
+     * @param mesh Mesh whose faces were used to build the table.
+     * @return Index of the last half-face (in face order) with this node
+     *         set, or -1 if there is none.
+     */
+    int find(const int* nodes, int n_nodes, const Mesh& mesh) const;
+};
+
+/**
+ * @brief Builds the order-independent key of a node set.
+ *
+ * @param nodes Node indices, in any order.
+ * @param n_nodes Number of nodes.
+ * @param face Index of the half-face stored in the key.
+ * @return The key.
+ */
+FaceKey make_face_key(const int* nodes, int n_nodes, int face);
+
+/**
+ * @brief Builds the sorted table of the half-faces of a mesh.
+ *
+ * Keys are computed and counted per smallest node in parallel, scattered
+ * into their groups and every group is sorted in parallel. The result is
+ * independent of the number of threads.
+ *
+ * @param mesh Mesh whose half-faces are indexed.
+ * @return The face table.
+ */
+FaceTable build_face_table(const Mesh& mesh);
+
 /**
  * @brief Computes the properties and connectivity of faces in the mesh.
  *
  * This function calculates face areas, centroids, and element neighbors.
  * It identifies boundary faces and sets up opposite face relationships
- * between neighboring elements.
+ * between neighboring elements. Faces are numbered element by element
+ * from an exclusive prefix sum, so numbering is deterministic. Half-faces
+ * are paired through a sorted face table, which is returned for the
+ * boundary element lookup.
  *
  * @param mesh Reference to the Mesh structure containing faces and elements.
+ * @return The sorted face table of the mesh.
+ */
+FaceTable compute_faces(Mesh& mesh);
+
+/**
+ * @brief Builds unique faces and the per-slot element connectivity.
+ *
+ * Paired half-faces are grouped into unique faces in face order, so that
+ * the numbering does not depend on how pairs were found. Neighbor, unique
+ * face and sign arrays of the CSR connectivity are filled accordingly.
+ * Requires owner, neighbor and opposite indices of all faces.
+ *
+ * @param mesh Reference to the Mesh structure.
  */
-void compute_faces(Mesh& mesh);
+void compute_unique_faces(Mesh& mesh);
 
 /**
  * @brief Assign boundary conditions.
  *
+ * Boundary regions of the input are applied first, then the tags of the
+ * boundary elements, looked up in the face table. Must be called before
+ * the mesh is renumbered, while the face table is valid.
+ *
  * @param mesh Reference to the Mesh structure.
+ * @param boundary_elements Boundary elements carrying the boundary tags.
+ * @param table Face table returned by compute_faces.
  * @param input Reference to the simulation Input structure.
  */
-void assign_boundaries(Mesh& mesh, Input& input);
+void assign_boundaries(Mesh& mesh,
+                       const std::vector<Element>& boundary_elements,
+                       const FaceTable& table,
+                       Input& input);
 
 } // namespace eulercpp
@@ -0,0 +1,81 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file gmsh.hpp
+ * @brief Declares the readers of Gmsh mesh files.
+ *
+ * The mesh file is memory-mapped and its format is detected from the
+ * `$MeshFormat` header. Gmsh 2.2 ASCII sections are split into
+ * line-aligned chunks parsed concurrently, Gmsh 4.1 binary blocks are
+ * copied directly into the preallocated node and element arrays.
+ *
+ * @author Alessio Improta
+ */
+
+#pragma once
+
+#include <string>
+
+namespace eulercpp {
+
+struct Mesh;
+
+/**
+ * @enum MeshReader
+ * @brief Supported readers of Gmsh 2.2 ASCII mesh files.
+ */
+enum class MeshReader {
+    STREAM,     /**< Serial line by line reader (file stream) */
+    MAPPED      /**< Parallel reader of the memory-mapped file */
+};
+
+/**
+ * @brief Reads nodes and elements of a Gmsh mesh file.
+ *
+ * The file is memory-mapped and its `$MeshFormat` header selects the
+ * reader; files without header are read as Gmsh 2.2 ASCII.
+ *
+ * - Gmsh 2.2 ASCII: with the MAPPED reader, the bodies of the `$Nodes` and
+ *   `$Elements` sections are split into line-aligned chunks. Lines are
+ *   counted in parallel first, so that every chunk knows the index of its
+ *   first entry, and then parsed in parallel with `std::from_chars` into
+ *   the preallocated arrays. The STREAM reader parses the file line by
+ *   line. Both give identical results.
+ * - Gmsh 4.1 binary: node and element blocks are copied in parallel from
+ *   the mapping. Node tags are mapped to node indices, and element tags
+ *   are set to the physical tag and entity tag of their block, so that
+ *   boundary elements carry the same tags as in Gmsh 2.2 files.
+ *
+ * The parsing throughput is logged.
+ *
+ * @param filename Path of the mesh file.
+ * @param mesh Mesh whose nodes and elements are filled.
+ * @param reader Reader used for Gmsh 2.2 ASCII files.
+ *
+ * @throws std::invalid_argument If the mesh file cannot be opened.
+ * @throws std::runtime_error If the format is not supported, a section is
+ *         missing or unterminated, its number of entries does not match
+ *         its header, or an entry is malformed.
+ */
+void read_gmsh(const std::string& filename, Mesh& mesh,
+               MeshReader reader = MeshReader::MAPPED);
+
+} // namespace eulercpp
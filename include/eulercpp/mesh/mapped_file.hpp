@@ -0,0 +1,76 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file mapped_file.hpp
+ * @brief Read-only memory mapping of input files.
+ *
+ * Mesh files are parsed directly from a read-only memory mapping rather
+ * than through a stream, so that several threads can work on disjoint
+ * parts of the file without copying it into user buffers first.
+ *
+ * @author Alessio Improta
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace eulercpp {
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * The mapping is released when the object is destroyed. Objects can be
+ * moved but not copied.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Maps a file into memory.
+     *
+     * @param filename Path of the file to map.
+     * @throws std::invalid_argument If the file cannot be opened.
+     * @throws std::runtime_error If the file is empty or cannot be mapped.
+     */
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /** @brief First byte of the file. */
+    const char* data() const { return data_; }
+
+    /** @brief Size of the file in bytes. */
+    std::size_t size() const { return size_; }
+
+private:
+    void release() noexcept;
+
+    const char* data_ = nullptr;    /**< Start of the mapping. */
+    std::size_t size_ = 0;          /**< Mapped size in bytes. */
+};
+
+} // namespace eulercpp
@@ -39,8 +39,10 @@
 #include <eulercpp/mesh/nodes.hpp>
 #include <eulercpp/mesh/elements.hpp>
 #include <eulercpp/mesh/faces.hpp>
+#include <eulercpp/mesh/connectivity.hpp>
 #include <eulercpp/mesh/distances.hpp>
 #include <eulercpp/mesh/normals.hpp>
+#include <eulercpp/mesh/renumbering.hpp>
 
 namespace eulercpp {
 
@@ -57,10 +59,33 @@ struct Mesh {
     int n_elements = 0;             /**< Total number of elements. */
     int n_faces = 0;                /**< Total number of faces. */
     int n_boundaries = 0;           /**< Number of boundary faces. */
+    int n_unique_faces = 0;         /**< Number of unique faces. */
 
     std::vector<Node> nodes;        /**< Container of all nodes. */
     std::vector<Element> elements;  /**< Container of all elements. */
     std::vector<Face> faces;        /**< Container of all faces. */
+    std::vector<double> volumes;    /**< Element volumes (contiguous). */
+
+    std::vector<UniqueFace> unique_faces; /**< Faces shared by elements. */
+
+    Connectivity csr;               /**< Element-to-face connectivity. */
+
+    /** Current index of each element in mesh file order (empty if the
+     *  elements were not renumbered). */
+    std::vector<int> file_to_element;
+
+    /**
+     * @brief Current index of an element given its mesh file position.
+     *
+     * Outputs and restart files loop over elements in file order through
+     * this mapping, so that they are independent of renumbering.
+     *
+     * @param k Position of the element among the mesh file cells.
+     * @return Index of the element in the elements container.
+     */
+    inline int from_file(int k) const noexcept {
+        return file_to_element.empty() ? k : file_to_element[k];
+    }
 
     /**
      * @brief Initializes boundary flags for faces based on input settings.
@@ -78,7 +103,8 @@ struct Mesh {
  *
  * This function opens the specified mesh file and sequentially calls
  * the necessary functions to read nodes, read elements, compute element
- * and face properties, face normals, and distances.
+ * and face properties, face normals, and distances. When the mesh cache
+ * is enabled, a valid `<mesh_file>.cache` replaces all of these steps.
  *
  * @param sim The simulation object containing mesh and input information.
  * @throws std::invalid_argument If the mesh file cannot be opened.
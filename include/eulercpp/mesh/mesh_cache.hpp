@@ -0,0 +1,95 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file mesh_cache.hpp
+ * @brief Declares the binary cache of preprocessed meshes.
+ *
+ * Reading and preprocessing a large mesh (element and face geometry,
+ * connectivity, renumbering, boundary flags, normals and gradient weights)
+ * is repeated identically by every run of the same case. The fully
+ * preprocessed mesh is therefore stored in a versioned binary file next
+ * to the mesh file, keyed by a hash of the mesh file content and of the
+ * input settings that affect preprocessing. The cache is several times
+ * larger than the mesh file, so it is only used when enabled in the input.
+ *
+ * @author Alessio Improta
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace eulercpp {
+
+struct Input;
+struct Mesh;
+
+/**
+ * @brief Computes the key of the preprocessed mesh of a case.
+ *
+ * The key hashes the content of the mesh file together with the settings
+ * used by preprocessing: dimension, gradient method, renumbering, minimum
+ * volume and the boundary regions. The mesh file is hashed in parallel
+ * from a memory mapping.
+ *
+ * @param filename Path of the mesh file.
+ * @param input Input settings.
+ * @return The cache key.
+ * @throws std::invalid_argument If the mesh file cannot be opened.
+ */
+std::uint64_t mesh_cache_key(const std::string& filename, const Input& input);
+
+/**
+ * @brief Loads a preprocessed mesh from a cache file.
+ *
+ * The cache file is memory-mapped read-only and its arrays are copied
+ * into the mesh, so every process holds its own copy of the mesh; only
+ * the file pages are shared through the page cache. Face tangents are
+ * recomputed from the normals. Face node lists are not stored, as they
+ * are only used by preprocessing: loaded faces have `n_nodes = 0` and no
+ * `nodes`.
+ * Missing files, files written by another version or build, and files
+ * with another key are ignored.
+ *
+ * @param filename Path of the cache file.
+ * @param key Expected cache key.
+ * @param mesh Mesh to fill.
+ * @return True if the mesh was loaded from the cache.
+ */
+bool load_mesh_cache(const std::string& filename, std::uint64_t key,
+                     Mesh& mesh);
+
+/**
+ * @brief Writes a preprocessed mesh to a cache file.
+ *
+ * The file is written under a temporary name and renamed, so that
+ * concurrent runs never map a partially written cache. Failures are
+ * logged as warnings and do not stop the run.
+ *
+ * @param filename Path of the cache file.
+ * @param key Cache key.
+ * @param mesh Preprocessed mesh.
+ */
+void save_mesh_cache(const std::string& filename, std::uint64_t key,
+                     const Mesh& mesh);
+
+} // namespace eulercpp
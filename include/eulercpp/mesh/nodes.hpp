@@ -24,7 +24,7 @@
  *
  * This header provides the Node structure used to represent a mesh node
  * in 3D space, including a unique identifier and Cartesian coordinates.
- * It also declares the function to read nodes from a mesh file into a Mesh.
+ * It also declares the functions to parse and read nodes from a mesh file.
  *
  * @author Alessio Improta
  */
@@ -51,6 +51,17 @@ struct Node {
     std::array<double, 3> position; /**< Cartesian coordinates (x, y, z). */
 };
 
+/**
+ * @brief Parses a node line of the `$Nodes` section.
+ *
+ * @param p Start of the line.
+ * @param end End of the line.
+ * @param node Node to fill.
+ * @return Position right after the last coordinate.
+ * @throws std::runtime_error If the line is not `<id> <x> <y> <z>`.
+ */
+const char* parse_node(const char* p, const char* end, Node& node);
+
 /**
  * @brief Reads the node data from a mesh file into the mesh structure.
  *
@@ -69,4 +69,14 @@ struct Mesh;
  */
 void compute_normals(Mesh& mesh);
 
+/**
+ * @brief Computes the tangent vectors `t1` and `t2` of all mesh faces.
+ *
+ * The tangents only depend on the face normal, so they can be rebuilt
+ * from the normals without the rest of the preprocessing.
+ *
+ * @param mesh Reference to the mesh with computed face normals.
+ */
+void compute_tangents(Mesh& mesh);
+
 } // namespace eulercpp
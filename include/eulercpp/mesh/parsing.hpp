@@ -0,0 +1,73 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file parsing.hpp
+ * @brief Locale-independent number parsing for mesh files.
+ *
+ * Thin wrappers around `std::from_chars` that skip the blanks separating
+ * the fields of a mesh file line. Parsing never allocates and does not
+ * depend on the global locale, so it can run concurrently on disjoint
+ * parts of a memory-mapped file.
+ *
+ * @author Alessio Improta
+ */
+
+#pragma once
+
+#include <charconv>
+#include <stdexcept>
+#include <system_error>
+
+namespace eulercpp {
+
+/**
+ * @brief Skips spaces, tabs and carriage returns.
+ *
+ * @param p Current position.
+ * @param end End of the buffer.
+ * @return First position that is not a blank (or end).
+ */
+inline const char* skip_blanks(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+    return p;
+}
+
+/**
+ * @brief Parses the next integer or floating point field of a line.
+ *
+ * @tparam T Arithmetic type of the field.
+ * @param p Current position.
+ * @param end End of the line.
+ * @param out Parsed value.
+ * @return Position right after the parsed field.
+ * @throws std::runtime_error If no valid number starts at the position.
+ */
+template <typename T>
+inline const char* parse_field(const char* p, const char* end, T& out) {
+    p = skip_blanks(p, end);
+    const auto [ptr, ec] = std::from_chars(p, end, out);
+    if (ec != std::errc()) {
+        throw std::runtime_error("Malformed number in mesh file.");
+    }
+    return ptr;
+}
+
+} // namespace eulercpp
@@ -37,6 +37,7 @@
 #pragma once
 
 #include <array>
+#include <tuple>
 #include <vector>
 
 #include <eulercpp/mesh/nodes.hpp>
@@ -49,6 +50,38 @@ namespace eulercpp {
  */
 using Point3D = std::array<double, 3>;
 
+/**
+ * @brief Maximum number of nodes of a standard element (hexahedron).
+ */
+constexpr int max_shape_nodes = 8;
+
+/**
+ * @typedef ShapeBuffer
+ * @brief Fixed-capacity buffer for the node positions of a standard shape.
+ */
+using ShapeBuffer = std::array<Point3D, max_shape_nodes>;
+
+/**
+ * @brief Gathers the positions of a list of nodes.
+ *
+ * Positions are copied into the fixed-capacity buffer when they fit, and
+ * into the scratch vector otherwise (polygons and polyhedron faces). The
+ * scratch vector is meant to be owned by a thread and reused across
+ * calls, so that it only allocates when it grows.
+ *
+ * @param mesh Mesh providing node coordinates.
+ * @param nodes Node indices.
+ * @param n_nodes Number of nodes.
+ * @param buffer Fixed-capacity buffer.
+ * @param scratch Per-thread scratch vector for larger node lists.
+ * @return Pointer to the first gathered position.
+ */
+const Point3D* gather_positions(const Mesh& mesh,
+                                const int* nodes,
+                                int n_nodes,
+                                ShapeBuffer& buffer,
+                                std::vector<Point3D>& scratch);
+
 /**
  * @brief Computes the centroid of a triangle in 3D space.
  *
@@ -112,46 +145,48 @@ double tetra_volume(const Point3D& p1,
 /**
  * @brief Computes centroid, area, and characteristic length of a polygon.
  *
- * @param nodes List of polygon vertices in order.
+ * @param nodes Polygon vertices in order.
+ * @param n_nodes Number of vertices.
  * @return Tuple (centroid, area, characteristic length).
  */
 std::tuple<Point3D, double, double>
-polygon_properties(const std::vector<Point3D>& nodes);
+polygon_properties(const Point3D* nodes, int n_nodes);
 
 /**
  * @brief Computes centroid, volume, and characteristic length of a hexahedron.
  *
  * Assumes the hexahedron is convex and nodes are ordered consistently.
  *
- * @param nodes List of 8 hexahedron vertices.
+ * @param nodes The 8 hexahedron vertices.
  * @return Tuple (centroid, volume, characteristic length).
  */
 std::tuple<Point3D, double, double>
-hexa_properties(const std::vector<Point3D>& nodes);
+hexa_properties(const Point3D* nodes);
 
 /**
  * @brief Computes centroid, volume, and characteristic length of a prism.
  *
- * @param nodes List of prism vertices.
+ * @param nodes The 6 prism vertices.
  * @return Tuple (centroid, volume, characteristic length).
  */
 std::tuple<Point3D, double, double>
-prism_properties(const std::vector<Point3D>& nodes);
+prism_properties(const Point3D* nodes);
 
 /**
  * @brief Computes centroid, volume, and characteristic length of a pyramid.
  *
- * @param nodes List of pyramid vertices.
+ * @param nodes The 5 pyramid vertices.
  * @return Tuple (centroid, volume, characteristic length).
  */
 std::tuple<Point3D, double, double>
-pyramid_properties(const std::vector<Point3D>& nodes);
+pyramid_properties(const Point3D* nodes);
 
 /**
  * @brief Computes centroid, volume, and characteristic length of a polyhedron.
  *
  * The polyhedron may have an arbitrary number of faces and vertices.
- * Properties are computed via decomposition into tetrahedra.
+ * Properties are computed via decomposition into tetrahedra, reading node
+ * coordinates in place without temporary storage.
  *
  * @param n_faces Number of faces.
  * @param nodes Node indices defining the polyhedron.
@@ -161,6 +196,6 @@ pyramid_properties(const std::vector<Point3D>& nodes);
 std::tuple<Point3D, double, double>
 polyhedron_properties(const int n_faces,
                       const std::vector<int>& nodes,
-                      Mesh& mesh);
+                      const Mesh& mesh);
 
 } // namespace eulercpp
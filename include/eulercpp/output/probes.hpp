@@ -57,8 +57,8 @@ std::ofstream init_probes(Simulation& sim, const std::string& filepath);
  * Data is written in scientific notation with 7-digit precision.
  *
  * @param sim Constant reference to the simulation object.
- * @param ofs Reference to the probes output file stream.
+ * @param ofs Reference to the probes output stream.
  */
-void write_probes(const Simulation& sim, std::ofstream& ofs);
+void write_probes(const Simulation& sim, std::ostream& ofs);
 
 } // namespace eulercpp::probes
@@ -58,8 +58,8 @@ std::ofstream init_reports(const Simulation& sim, const std::string& filepath);
  * precision.
  *
  * @param sim Constant reference to the simulation object.
- * @param ofs Reference to the reports output file stream.
+ * @param ofs Reference to the reports output stream.
  */
-void write_reports(const Simulation& sim, std::ofstream& ofs);
+void write_reports(const Simulation& sim, std::ostream& ofs);
 
 } // namespace eulercpp::reports
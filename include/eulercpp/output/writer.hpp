@@ -32,6 +32,7 @@
 
 #include <string>
 #include <fstream>
+#include <sstream>
 
 #include <eulercpp/simulation/simulation.hpp>
 
@@ -145,6 +146,28 @@ public:
      */
     static void save_reports(const Simulation& sim);
 
+    /**
+     * @brief Holds probe and report rows in memory.
+     *
+     * While enabled, rows are appended to in-memory buffers instead of
+     * the CSV files, so that the rows of iterations discarded by a
+     * rollback can be dropped. Buffered rows are written to the files by
+     * `flush_buffers()`.
+     *
+     * @param enable Whether probe and report rows are buffered.
+     */
+    static void set_buffered(bool enable);
+
+    /**
+     * @brief Writes the buffered probe and report rows to their files.
+     */
+    static void flush_buffers();
+
+    /**
+     * @brief Drops the buffered probe and report rows.
+     */
+    static void discard_buffers();
+
     /**
      * @brief File stream for writing probe data.
      */
@@ -163,6 +186,10 @@ private:
     static RestartFormat restart_format_;   /**< Selected restart format. */
     static std::string output_dir_;         /**< Output directory path. */
     static std::string output_name_;        /**< Base name for output files. */
+
+    static bool buffered_;                  /**< Buffer probes and reports. */
+    static std::ostringstream probes_buffer_;   /**< Pending probe rows. */
+    static std::ostringstream reports_buffer_;  /**< Pending report rows. */
 };
 
 } // namespace eulercpp
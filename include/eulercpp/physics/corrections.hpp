@@ -30,10 +30,28 @@
 
 #pragma once
 
+#include <stdexcept>
+#include <string>
+
 #include <eulercpp/simulation/simulation.hpp>
 
 namespace eulercpp::physics {
 
+/**
+ * @brief Raised when too many cells need corrections.
+ *
+ * The solution can no longer be repaired locally; the solver may roll
+ * back to an earlier snapshot.
+ */
+class FloatingPointError : public std::runtime_error {
+public:
+    FloatingPointError()
+        : std::runtime_error("A floating point error has occurred.") {}
+
+    explicit FloatingPointError(const std::string& what)
+        : std::runtime_error(what) {}
+};
+
 void apply_corrections(Simulation& sim);
 
 } // namespace eulercpp::physics
@@ -32,12 +32,16 @@
 
 #pragma once
 
+#include <array>
+
+#include <eulercpp/physics/riemann.hpp>
 #include <eulercpp/simulation/simulation.hpp>
 
 namespace eulercpp::physics {
 
 /**
- * @brief Compute convective fluxes across all mesh faces.
+ * @brief Compute convective fluxes across all mesh faces, with a Riemann
+ *        solver selected at compile time.
  *
  * For each face, the function:
  * 1. Extracts the left and right states in the face-normal coordinate system.
@@ -47,8 +51,35 @@ namespace eulercpp::physics {
  *
  * This operation is parallelized using OpenMP.
  *
+ * @tparam R Riemann solver.
  * @param sim Reference to the Simulation object.
  */
+template <Riemann R>
 void compute_fluxes(Simulation& sim);
 
+/**
+ * @brief Inviscid flux of a state projected on a normal vector.
+ *
+ * The flux is linear in `n`, which may be a unit normal or an area
+ * vector.
+ *
+ * @param W Conservative state.
+ * @param n Normal vector.
+ * @param gam Specific heat ratio.
+ * @param F Output flux.
+ */
+inline void normal_flux(const double* W, const std::array<double, 3>& n,
+                        double gam, double* F) {
+    const double inv_rho = 1.0 / W[0];
+    const double un = (W[1]*n[0] + W[2]*n[1] + W[3]*n[2]) * inv_rho;
+    const double K = 0.5 * (W[1]*W[1] + W[2]*W[2] + W[3]*W[3]) * inv_rho;
+    const double p = (gam - 1.0) * (W[4] - K);
+
+    F[0] = W[0] * un;
+    F[1] = W[1] * un + p * n[0];
+    F[2] = W[2] * un + p * n[1];
+    F[3] = W[3] * un + p * n[2];
+    F[4] = (W[4] + p) * un;
+}
+
 } // namespace eulercpp::physics
@@ -25,14 +25,17 @@
  * Implements the exact/approximate Riemann solver for convective flux
  * computation across faces.
  *
- * Provides a single interface function `riemann` to compute fluxes
- * from left and right states in the face-normal direction.
+ * Provides the batched interface `riemann_batch`, which computes
+ * `riemann_width` fluxes at once using the widest SIMD instruction set
+ * enabled at compile time. The solver is selected at compile time.
  *
  * @author Alessio Improta
  */
 
 #pragma once
 
+#include <eulercpp/math/simd.hpp>
+
 namespace eulercpp::physics {
 
 /**
@@ -45,31 +48,24 @@ enum class Riemann {
     HLLC,       /**< HLLC (Harten-Lax-van Leer-Contact) solver */
 };
 
-/**
- * @brief Function pointer type for Riemann solvers.
- */
-using RiemannSolver = void(*)(
-    const double*, const double*, double*, const double
-);
-
-/**
- * @brief Initializes the Riemann solver.
- *
- * @param solver Selected Riemann solver.
- */
-void init_riemann(Riemann solver);
+/** @brief Number of faces processed by a call to `riemann_batch`. */
+constexpr int riemann_width = math::simd::Native::width;
 
 /**
- * @brief Compute the Riemann flux across a face.
+ * @brief Compute the Riemann fluxes across a batch of faces with a solver
+ *        selected at compile time.
  *
- * This function computes the Riemann flux across a face using the selected
- * Riemann solver function.
+ * States and fluxes are stored variable by variable for `riemann_width`
+ * faces, i.e. `WL[v*riemann_width + lane]`, and must be aligned to 64 bytes.
  *
- * @param WL Pointer to the left state array.
- * @param WR Pointer to the right state array.
- * @param F  Pointer to the output flux array.
+ * @tparam R Riemann solver.
+ * @param WL Pointer to the left states.
+ * @param WR Pointer to the right states.
+ * @param F  Pointer to the output fluxes.
  * @param gam Specific heat ratio of the fluid.
  */
-void riemann(const double* WL, const double* WR, double* F, const double gam);
+template <Riemann R>
+void riemann_batch(const double* WL, const double* WR, double* F,
+                   const double gam);
 
 } // namespace eulercpp::physics
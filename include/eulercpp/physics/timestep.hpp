@@ -23,7 +23,8 @@
  * @brief Declaration of timestep update routines.
  *
  * This file declares functions that compute the next timestep based on
- * CFL constraints using the current state of the simulation.
+ * CFL constraints using the current state of the simulation, and the
+ * controller adapting the CFL number during the run.
  *
  * Parallel computation using OpenMP is supported for efficiency.
  *
@@ -49,4 +50,21 @@ namespace eulercpp::physics {
  */
 void update_timestep(Simulation& sim);
 
+/**
+ * @brief Adapts the CFL number to the residual history.
+ *
+ * Switched evolution relaxation: when `cfl_ramp` is enabled, the CFL
+ * number is multiplied by the ratio of the previous to the current
+ * density residual (at most doubling per call) and kept between
+ * `status.cfl_min` (initially `CFL`, lowered by rollbacks) and `CFL_max`,
+ * so that it grows as `CFL * R0 / R` while the residual decreases. If
+ * `apply_corrections` corrected any cell since the last call while above
+ * `status.cfl_min`, the CFL number is halved instead (not below it).
+ *
+ * Called once per iteration, after the solution update.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void update_cfl(Simulation& sim);
+
 } // namespace eulercpp::physics
@@ -24,8 +24,20 @@
  *
  * This header provides the Fields class, which stores the conservative
  * variables, source terms, fluxes, gradients, and RHS vectors for a
- * simulation. Fields are stored in a contiguous, cache-friendly layout
- * for efficient access.
+ * simulation, together with a cache of primitive variables. Fields are
+ * stored in a contiguous, cache-friendly layout for efficient access.
+ *
+ * The memory layout is selected at compile time (EULERCPP_FIELD_LAYOUT
+ * CMake option) and hidden behind the accessors:
+ * - AOS  : `[cell*5 + var]`, all variables of a cell are adjacent.
+ * - SOA  : `[var*n + cell]`, each variable is a contiguous array, so
+ *          cell-wise kernels vectorize across cells (default).
+ * - AOSOA: blocks of `Fields::block` cells, stored as SOA inside a block.
+ *
+ * The primitive cache (velocity, pressure, speed of sound and inverse
+ * density, see `prim`) is refreshed by `update_primitives` after every
+ * change of the conservative variables, and is the single source of
+ * primitive quantities for time step, sources, corrections and output.
  *
  * @author Alessio Improta
  */
@@ -33,7 +45,9 @@
 #pragma once
 
 #include <vector>
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstring>
 #include <omp.h>
 
@@ -42,6 +56,55 @@
 
 namespace eulercpp {
 
+/**
+ * @brief Indices of the cached primitive variables (see Fields::P).
+ */
+namespace prim {
+    constexpr int u = 0;        /**< Velocity x-component */
+    constexpr int v = 1;        /**< Velocity y-component */
+    constexpr int w = 2;        /**< Velocity z-component */
+    constexpr int p = 3;        /**< Static pressure */
+    constexpr int a = 4;        /**< Speed of sound */
+    constexpr int inv_rho = 5;  /**< Inverse of the density */
+    constexpr int n = 6;        /**< Number of primitive variables */
+}
+
+/**
+ * @brief Residual norms of the RHS, per conservative variable.
+ *
+ * While accumulating (`add`, `merge`), L2 holds sums of squares;
+ * `finalize` takes the square roots.
+ */
+struct Residuals {
+    std::array<double, 5> L1 = {0.0};   /**< Sum of absolute values */
+    std::array<double, 5> L2 = {0.0};   /**< Euclidean norm */
+    std::array<double, 5> Linf = {0.0}; /**< Maximum absolute value */
+
+    /** @brief Accumulates the RHS entry `b` of variable `v`. */
+    inline void add(int v, double b) noexcept {
+        const double abs_b = std::abs(b);
+        L1[v] += abs_b;
+        L2[v] += b * b;
+        Linf[v] = std::max(Linf[v], abs_b);
+    }
+
+    /** @brief Merges partial norms accumulated over other cells. */
+    inline void merge(const Residuals& other) noexcept {
+        for (int v = 0; v < 5; ++v) {
+            L1[v] += other.L1[v];
+            L2[v] += other.L2[v];
+            Linf[v] = std::max(Linf[v], other.Linf[v]);
+        }
+    }
+
+    /** @brief Turns the accumulated sums of squares into L2 norms. */
+    inline void finalize() noexcept {
+        for (int v = 0; v < 5; ++v) {
+            L2[v] = std::sqrt(L2[v]);
+        }
+    }
+};
+
 /**
  * @class Fields
  * @brief Manages all field data for the simulation.
@@ -52,6 +115,9 @@ namespace eulercpp {
  * - Gradients of conservative variables
  * - Face-centered values and fluxes
  * - RHS vectors for residual computations
+ * - Cached primitive variables
+ * - Local time steps (steady-state mode)
+ * - Residual norms and unphysical cells of the last solution update
  *
  * Provides accessors for cell-based and face-based data, and utility
  * functions for initialization and solution updates.
@@ -81,7 +147,7 @@ public:
      * @return Reference to the conservative variable W[cell, var]
      */
     inline double& W(int cell, int var) noexcept {
-        return conservatives[cell * n_var + var];
+        return conservatives[index(cell, var, n_cells)];
     }
 
     /**
@@ -92,52 +158,117 @@ public:
      * @return Const reference to the conservative variable W[cell, var]
      */
     inline const double& W(int cell, int var) const noexcept {
-        return conservatives[cell * n_var + var];
+        return conservatives[index(cell, var, n_cells)];
+    }
+
+    /**
+     * @brief Access the conservative variable W from the previous iteration.
+     * @param cell Index of the cell
+     * @param var Index of the conservative variable
+     * @return Reference to the old conservative variable Wold[cell, var]
+     */
+    inline double& Wold(int cell, int var) noexcept {
+        return conservatives_old[index(cell, var, n_cells)];
+    }
+
+    /**
+     * @brief Const access to the previous iteration conservative variable.
+     * @param cell Index of the cell
+     * @param var Index of the conservative variable
+     * @return Const reference to the old conservative variable Wold[cell, var]
+     */
+    inline const double& Wold(int cell, int var) const noexcept {
+        return conservatives_old[index(cell, var, n_cells)];
     }
 
     /**
-     * @brief Provides direct pointer access to the underlying array
-     * of conservative variables.
+     * @brief Const access to a cached primitive variable.
      *
-     * Allows for high-performance bulk operations such as reading/writing
-     * binary data without using W(i,v) in loops.
+     * Valid after the last call to `update_primitives` (or
+     * `update_primitives(cell)`) following a change of W.
      *
-     * @return Pointer to the first element of the conservatives array
+     * @param cell Index of the cell
+     * @param var Index of the primitive variable (see `prim`)
+     * @return Const reference to the primitive variable P[cell, var]
      */
-    inline double* Wdata() noexcept {
-        return conservatives.data();
+    inline const double& P(int cell, int var) const noexcept {
+        return primitives[index(cell, var, n_cells, prim::n)];
     }
 
     /**
-     * @brief Provides const direct pointer access to the underlying
-     * array of conservative variables.
+     * @brief Recompute the primitive variables of a cell from W.
      *
-     * Allows for high-performance bulk read operations on the array.
+     * Pressure is not clipped, so that unphysical states remain
+     * detectable; the speed of sound is then NaN.
      *
-     * @return Const pointer to the first element of the conservatives array
+     * @param cell Index of the cell
      */
-    inline const double* Wdata() const noexcept {
-        return conservatives.data();
+    inline void update_primitives(int cell) noexcept {
+        const double rho = W(cell, 0);
+        const double u = W(cell, 1) / rho;
+        const double v = W(cell, 2) / rho;
+        const double w = W(cell, 3) / rho;
+        const double K = 0.5*rho*(u*u+v*v+w*w);
+        const double p = (gam-1.0)*(W(cell, 4) - K);
+
+        primitives[index(cell, prim::u, n_cells, prim::n)] = u;
+        primitives[index(cell, prim::v, n_cells, prim::n)] = v;
+        primitives[index(cell, prim::w, n_cells, prim::n)] = w;
+        primitives[index(cell, prim::p, n_cells, prim::n)] = p;
+        primitives[index(cell, prim::a, n_cells, prim::n)] =
+            std::sqrt(gam * p / rho);
+        primitives[index(cell, prim::inv_rho, n_cells, prim::n)] = 1.0 / rho;
     }
 
     /**
-     * @brief Access the conservative variable W from the previous iteration.
+     * @brief Checks whether the state of a cell is physical.
+     *
+     * A state is physical if all conservative variables are finite and
+     * density and cached pressure are non-negative (a NaN pressure from a
+     * vanishing density is unphysical). Requires an up-to-date primitive
+     * cache for the cell.
+     *
      * @param cell Index of the cell
-     * @param var Index of the conservative variable
-     * @return Reference to the old conservative variable Wold[cell, var]
+     * @return True if the state is physical
      */
-    inline double& Wold(int cell, int var) noexcept {
-        return conservatives_old[cell * n_var + var];
+    inline bool is_physical(int cell) const noexcept {
+        for (int v = 0; v < n_var; ++v) {
+            if (!std::isfinite(W(cell, v))) return false;
+        }
+        return P(cell, prim::p) >= 0.0 && W(cell, 0) >= 0.0;
     }
 
     /**
-     * @brief Const access to the previous iteration conservative variable.
+     * @brief Recompute the primitive variables of all cells from W.
+     *
+     * Must be called after every update of the conservative variables.
+     */
+    void update_primitives() noexcept {
+        #pragma omp parallel for
+        for (int i = 0; i < n_elements; ++i) {
+            update_primitives(i);
+        }
+    }
+
+    /**
+     * @brief Access the local time step of a cell.
+     *
+     * Only allocated with local time stepping (see `init`).
+     *
      * @param cell Index of the cell
-     * @param var Index of the conservative variable
-     * @return Const reference to the old conservative variable Wold[cell, var]
+     * @return Reference to the time step of the cell
      */
-    inline const double& Wold(int cell, int var) const noexcept {
-        return conservatives_old[cell * n_var + var];
+    inline double& dt(int cell) noexcept {
+        return dt_cells[cell];
+    }
+
+    /**
+     * @brief Const access to the local time step of a cell.
+     * @param cell Index of the cell
+     * @return Const reference to the time step of the cell
+     */
+    inline const double& dt(int cell) const noexcept {
+        return dt_cells[cell];
     }
 
     /**
@@ -147,7 +278,7 @@ public:
      * @return Reference to the source term S[cell, var]
      */
     inline double& S(int cell, int var) noexcept {
-        return sources[cell * n_var + var];
+        return sources[index(cell, var, n_cells)];
     }
 
     /**
@@ -157,7 +288,7 @@ public:
      * @return Const reference to the source term S[cell, var]
      */
     inline const double& S(int cell, int var) const noexcept {
-        return sources[cell * n_var + var];
+        return sources[index(cell, var, n_cells)];
     }
 
     /**
@@ -169,7 +300,7 @@ public:
      */
     inline std::array<double, 3>&
     gradW(int cell, int var) noexcept {
-        return grad_conservatives[cell * n_var + var];
+        return grad_conservatives[index(cell, var, n_cells)];
     }
 
     /**
@@ -180,7 +311,7 @@ public:
      */
     inline const std::array<double, 3>&
     gradW(int cell, int var) const noexcept {
-        return grad_conservatives[cell * n_var + var];
+        return grad_conservatives[index(cell, var, n_cells)];
     }
 
     /**
@@ -190,7 +321,7 @@ public:
      * @return Reference to Wface[face, var]
      */
     inline double& Wf(int face, int var) noexcept {
-        return Wface[face * n_var + var];
+        return Wface[index(face, var, n_faces)];
     }
 
     /**
@@ -200,27 +331,34 @@ public:
      * @return Const reference to Wface[face, var]
      */
     inline const double& Wf(int face, int var) const noexcept {
-        return Wface[face * n_var + var];
+        return Wface[index(face, var, n_faces)];
     }
 
     /**
-     * @brief Access the convective flux F at a given face and variable.
-     * @param face Index of the face
+     * @brief Access the convective flux F at a given unique face and
+     * variable.
+     *
+     * The flux is oriented along the normal of the left half-face of the
+     * unique face; elements on the right side must use it with a minus
+     * sign (see Face::sign).
+     *
+     * @param face Index of the unique face
      * @param var Index of the variable
      * @return Reference to fluxF[face, var]
      */
     inline double& F(int face, int var) noexcept {
-        return fluxF[face * n_var + var];
+        return fluxF[index(face, var, n_unique_faces)];
     }
 
     /**
-     * @brief Const access the convective flux F at a given face and variable.
-     * @param face Index of the face
+     * @brief Const access the convective flux F at a given unique face
+     * and variable.
+     * @param face Index of the unique face
      * @param var Index of the variable
      * @return Const reference to fluxF[face, var]
      */
     inline const double& F(int face, int var) const noexcept {
-        return fluxF[face * n_var + var];
+        return fluxF[index(face, var, n_unique_faces)];
     }
 
     /**
@@ -230,7 +368,7 @@ public:
      * @return Reference to rhs[cell, var]
      */
     inline double& b(int cell, int var) noexcept {
-        return rhs[cell * n_var + var];
+        return rhs[index(cell, var, n_cells)];
     }
 
     /**
@@ -240,38 +378,74 @@ public:
      * @return Const reference to rhs[cell, var]
      */
     inline const double& b(int cell, int var) const noexcept {
-        return rhs[cell * n_var + var];
+        return rhs[index(cell, var, n_cells)];
     }
 
     /**
-     * @brief Compute the L1 residuals over all elements.
+     * @brief L1 residuals of the last solution update.
      *
      * @return Sums of absolute RHS entries.
      */
-    const std::array<double, 5> get_residuals() const noexcept {
-        std::array<double, 5> residual = {0.0};
-        #pragma omp parallel for
-        for (int i = 0; i < n_elements; ++i) {
-            for (int v = 0; v < n_var; ++v) {
-                residual[v] += std::abs(rhs[i * n_var + v]);
-            }
-        }
-        return residual;
+    const std::array<double, 5>& get_residuals() const noexcept {
+        return norms.L1;
+    }
+
+    /**
+     * @brief Residual norms of the last solution update.
+     *
+     * Accumulated by the solution update together with the new state.
+     *
+     * @return Reference to the residual norms.
+     */
+    inline Residuals& residuals() noexcept {
+        return norms;
+    }
+
+    /**
+     * @brief Const access to the residual norms of the last update.
+     * @return Const reference to the residual norms.
+     */
+    inline const Residuals& residuals() const noexcept {
+        return norms;
+    }
+
+    /**
+     * @brief Cells left unphysical by the last solution update.
+     *
+     * Filled by the solution update in ascending order and consumed by
+     * `physics::apply_corrections`.
+     *
+     * @return Reference to the list of cell indices.
+     */
+    inline std::vector<int>& unphysical_cells() noexcept {
+        return unphysical;
+    }
+
+    /**
+     * @brief Const access to the unphysical cells of the last update.
+     * @return Const reference to the list of cell indices.
+     */
+    inline const std::vector<int>& unphysical_cells() const noexcept {
+        return unphysical;
     }
 
     /**
      * @brief Allocate and initialize all field arrays.
      *
-     * Initializes conservative variables, source terms, gradients,
-     * face values, fluxes, and RHS vectors to zero.
+     * Initializes conservative variables, source terms, face values,
+     * fluxes, and RHS vectors to zero. Gradients are allocated on demand
+     * by `init_gradients`; local time steps only if enabled in the input.
      *
      * @param mesh Simulation mesh
      * @param input Simulation input parameters
      */
     void init(const Mesh& mesh, const Input& input) {
         n_elements = mesh.n_elements;
-        n_faces = mesh.n_faces;
+        n_cells = padded(mesh.n_elements);
+        n_faces = padded(mesh.n_faces);
+        n_unique_faces = padded(mesh.n_unique_faces);
         n_var = 5;
+        gam = input.fluid.gamma;
 
         switch(input.physics.dimension) {
             case 3:     dim = 3;    break;
@@ -280,13 +454,28 @@ public:
         }
 
         Logger::debug() << "Allocating fields...";
-        conservatives.assign(n_elements * n_var, 0.0);
-        conservatives_old.assign(n_elements * n_var, 0.0);
-        sources.assign(n_elements * n_var, 0.0);
-        grad_conservatives.assign(n_elements * n_var, {0.0, 0.0, 0.0});
+        conservatives.assign(n_cells * n_var, 0.0);
+        conservatives_old.assign(n_cells * n_var, 0.0);
+        sources.assign(n_cells * n_var, 0.0);
         Wface.assign(n_faces * n_var, 0.0);
-        fluxF.assign(n_faces * n_var, 0.0);
-        rhs.assign(n_elements * n_var, 0.0);
+        fluxF.assign(n_unique_faces * n_var, 0.0);
+        rhs.assign(n_cells * n_var, 0.0);
+        primitives.assign(n_cells * prim::n, 0.0);
+        if (input.numerical.local_timestep) {
+            dt_cells.assign(n_elements, 0.0);
+        }
+    }
+
+    /**
+     * @brief Allocate the gradient array, if not allocated yet.
+     *
+     * Only kernels that store gradients (compute_gradients) need it; the
+     * fused MUSCL reconstruction does not.
+     */
+    void init_gradients() {
+        if (grad_conservatives.empty()) {
+            grad_conservatives.assign(n_cells * n_var, {0.0, 0.0, 0.0});
+        }
     }
 
     /**
@@ -303,11 +492,72 @@ public:
         );
     }
 
+    /**
+     * @brief Copies the conservative variables, in storage order.
+     * @param out Destination, resized as needed.
+     */
+    void save_conservatives(std::vector<double>& out) const {
+        out = conservatives;
+    }
+
+    /**
+     * @brief Restores conservative variables saved by `save_conservatives`
+     * and refreshes the primitive cache.
+     * @param in Saved conservative variables.
+     */
+    void load_conservatives(const std::vector<double>& in) {
+        std::memcpy(
+            conservatives.data(),
+            in.data(),
+            conservatives.size() * sizeof(double)
+        );
+        update_primitives();
+    }
+
+#if defined(EULERCPP_LAYOUT_AOSOA)
+    static constexpr int block = 8;     /**< Cells per AoSoA block */
+#else
+    static constexpr int block = 1;     /**< Cells per AoSoA block */
+#endif
+
 private:
+    /**
+     * @brief Rounds an entity count up to a whole number of blocks.
+     * @param n Number of entities
+     * @return Padded number of entities
+     */
+    static inline int padded(int n) noexcept {
+        return (n + block - 1) / block * block;
+    }
+
+    /**
+     * @brief Position of (entity, variable) in a field array.
+     * @param i Index of the cell or face
+     * @param var Index of the variable
+     * @param n Padded number of entities of the array
+     * @param nv Number of variables of the array
+     * @return Offset into the field array
+     */
+    static inline std::size_t
+    index(int i, int var, [[maybe_unused]] int n,
+          [[maybe_unused]] int nv = 5) noexcept {
+#if defined(EULERCPP_LAYOUT_AOS)
+        return static_cast<std::size_t>(i) * nv + var;
+#elif defined(EULERCPP_LAYOUT_AOSOA)
+        return static_cast<std::size_t>(i / block) * (block * nv)
+             + var * block + i % block;
+#else
+        return static_cast<std::size_t>(var) * n + i;
+#endif
+    }
+
     int n_elements = 0; /**< Number of elements in the mesh */
-    int n_faces = 0;    /**< Number of faces in the mesh */
+    int n_cells = 0;    /**< Padded number of elements */
+    int n_faces = 0;    /**< Padded number of faces in the mesh */
+    int n_unique_faces = 0; /**< Padded number of unique faces */
     int n_var = 5;      /**< Number of conservative variables */
     int dim = 0;        /**< Spatial dimension */
+    double gam = 1.4;   /**< Specific heat ratio */
 
     std::vector<double> conservatives;      /**< Conservative variables W */
     std::vector<double> conservatives_old;  /**< Previous iteration W */
@@ -317,7 +567,12 @@ private:
 
     std::vector<double> rhs;        /**< RHS vector b */
     std::vector<double> Wface;      /**< Face-centered variables */
-    std::vector<double> fluxF;      /**< Convective fluxes F */
+    std::vector<double> fluxF;      /**< Convective fluxes F (unique) */
+    std::vector<double> primitives; /**< Cached primitive variables */
+    std::vector<double> dt_cells;   /**< Local time steps */
+
+    Residuals norms;                /**< Residual norms of the last update */
+    std::vector<int> unphysical;    /**< Unphysical cells of the last update */
 };
 
 } // namespace eulercpp
@@ -58,6 +58,7 @@ void set_initial_conditions(Simulation& sim);
  * This function performs the following:
  * - Initializes the numerical limiter
  * - Selects the reconstruction scheme
+ * - Selects the specialized solver stage
  * - Configures axisymmetric physics if needed
  * - Sets up output format and output folder for results
  *
@@ -0,0 +1,79 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file pipeline.hpp
+ * @brief Compile-time specialized solver stage.
+ *
+ * The residual evaluation of a stage of the time integration (gradients,
+ * reconstruction, convective fluxes and boundary conditions) is
+ * instantiated for every combination of Riemann solver, reconstruction
+ * scheme, limiter and spatial dimension. `init_pipeline` selects the
+ * instantiation matching the input once, so that the per-face and
+ * per-cell loops contain no indirect calls, together with the solution
+ * update of the selected time integration.
+ *
+ * @author Alessio Improta
+ */
+
+#pragma once
+
+namespace eulercpp {
+
+struct Simulation;
+
+/**
+ * @brief Function pointer type for solver stages.
+ */
+using StageFunction = void(*)(Simulation&);
+
+/**
+ * @brief Selects the stage instantiation matching the simulation settings.
+ *
+ * Must be called after the fields have been initialized.
+ *
+ * @param sim Reference to the Simulation object.
+ * @throws std::invalid_argument if a scheme is unknown.
+ */
+void init_pipeline(const Simulation& sim);
+
+/**
+ * @brief Runs one stage of the time integration.
+ *
+ * Evaluates the residual with the instantiation selected by
+ * `init_pipeline`, updates the solution with the selected time
+ * integration and applies the corrections.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void run_stage(Simulation& sim);
+
+/**
+ * @brief Evaluates the convective fluxes of the current solution.
+ *
+ * Runs reconstruction, fluxes and boundary conditions of the selected
+ * instantiation, without updating the solution. Used by implicit schemes
+ * to evaluate the residual of perturbed states.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void evaluate_residual(Simulation& sim);
+
+} // namespace eulercpp
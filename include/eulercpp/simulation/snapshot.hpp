@@ -0,0 +1,70 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file snapshot.hpp
+ * @brief In-memory snapshots of the simulation state.
+ *
+ * A snapshot keeps a copy of the conservative variables together with
+ * the simulation time and iteration, so that the solver can roll back
+ * after a floating point failure instead of aborting the run.
+ *
+ * @author Alessio Improta
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace eulercpp {
+
+struct Simulation;
+
+/**
+ * @struct Snapshot
+ * @brief Saved solution and progress of a simulation.
+ */
+struct Snapshot {
+    std::vector<double> W;  /**< Conservative variables, storage order. */
+    double time = 0.0;      /**< Simulation time. */
+    int iteration = 0;      /**< Iteration number. */
+};
+
+/**
+ * @brief Saves the current solution, time and iteration.
+ *
+ * @param sim Reference to the Simulation object.
+ * @param snapshot Destination snapshot.
+ */
+void save_snapshot(const Simulation& sim, Snapshot& snapshot);
+
+/**
+ * @brief Restores a snapshot.
+ *
+ * The primitive cache is refreshed, the stage counter of the explicit
+ * scheme is reset and the CFL controller restarts from the restored
+ * solution. The CFL number itself is left to the caller.
+ *
+ * @param sim Reference to the Simulation object.
+ * @param snapshot Snapshot to restore.
+ */
+void restore_snapshot(Simulation& sim, const Snapshot& snapshot);
+
+} // namespace eulercpp
@@ -49,6 +49,15 @@ struct Status {
     /// @brief CFL number used for stability monitoring
     double cfl = 0.0;
 
+    /// @brief Lower bound of the CFL number (cut by rollbacks)
+    double cfl_min = 0.0;
+
+    /// @brief Density residual at the last CFL update
+    double cfl_residual = 0.0;
+
+    /// @brief Cells corrected since the last CFL update
+    int corrections = 0;
+
     /// @brief Flag indicating whether the simulation has been stopped
     bool stopped = false;
 };
@@ -28,6 +28,9 @@
  * Expected keys:
  *  - "mesh_file" : Path or name of the mesh input file.
  *  - "min_volume": Minimum allowed volume in the mesh (parsed as double).
+ *  - "renumbering": Element renumbering strategy (parsed as int).
+ *  - "mesh_reader": Mesh file reader (parsed as int).
+ *  - "mesh_cache": Preprocessed mesh cache (0/1).
  *
  * Missing keys leave the mesh settings at their default values.
  *
@@ -51,6 +54,11 @@ namespace eulercpp {
  * Specifically, it looks for:
  * - "mesh_file" : Path or name of the mesh input file.
  * - "min_volume": Minimum allowed volume in the mesh.
+ * - "renumbering": Element renumbering (0 = none, 1 = RCM, 2 = Hilbert,
+ *                  3 = Morton).
+ * - "mesh_reader": Mesh file reader (0 = serial stream, 1 = parallel
+ *                  memory-mapped), used for Gmsh 2.2 ASCII files.
+ * - "mesh_cache": Preprocessed mesh cache (0 = off, default, 1 = on).
  *
  * @param config A map containing all configuration keys and their string values.
  * @param input  Input structure to update with mesh parameters.
@@ -61,6 +69,19 @@ void load_mesh(const std::map<std::string, std::string>& config, Input& input) {
 
     it = config.find("min_volume");
     if (it != config.end()) input.mesh.min_volume = std::stod(it->second);
+
+    it = config.find("renumbering");
+    if (it != config.end())
+        input.mesh.renumbering = static_cast<Renumbering>(
+            std::stoi(it->second)
+        );
+
+    it = config.find("mesh_reader");
+    if (it != config.end())
+        input.mesh.reader = static_cast<MeshReader>(std::stoi(it->second));
+
+    it = config.find("mesh_cache");
+    if (it != config.end()) input.mesh.cache = std::stoi(it->second) != 0;
 }
 
 } // namespace eulercpp
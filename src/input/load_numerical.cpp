@@ -27,18 +27,35 @@
  *
  * Expected keys:
  *  - "time_stages"    : Number of stages in the time integration method.
+ *  - "time_integration": Time integration scheme identifier.
  *  - "a"              : Time integration coefficients (comma-separated).
  *  - "CFL"            : CFL number for the numerical scheme.
+ *  - "CFL_max"        : Largest CFL number of the CFL ramp.
+ *  - "cfl_ramp"       : Adaptive CFL number (0/1, default 1 with
+ *                       Newton-Krylov, 0 otherwise).
  *  - "maxtime"        : Maximum simulation time.
  *  - "maxiter"        : Maximum number of iterations.
+ *  - "local_timestep" : Per-cell time steps for steady state (0/1), with
+ *                       the spectral radius of the global time step.
  *  - "reconstruction" : Reconstruction method identifier.
+ *  - "gradient"       : Gradient method identifier.
  *  - "limiter"        : Slope limiter identifier.
+ *  - "preconditioner" : Newton-Krylov preconditioner identifier.
+ *  - "krylov_dim"     : Largest GMRES Krylov subspace.
+ *  - "krylov_tol"     : Relative GMRES tolerance.
+ *  - "residual_smoothing": Implicit residual smoothing coefficient.
+ *  - "smoothing_sweeps": Jacobi sweeps of the residual smoothing.
+ *  - "multigrid_levels": Number of coarse multigrid levels (0 = off).
+ *  - "multigrid_cycle": Multigrid cycle identifier (0 = V, 1 = W).
+ *  - "snapshot_delay" : Iterations between in-memory snapshots (0 = off,
+ *                       default).
+ *  - "rollback_attempts": Rollbacks allowed after a floating point error.
  *
  * Checks are performed to ensure the number of coefficients matches
  * the number of stages.
  *
  * @see input.hpp, input_helpers.hpp, load_numerical.hpp
- * @see math::Reconstruction, math::Limiter
+ * @see math::Reconstruction, math::Gradient, math::Limiter
  * @author Alessio Improta
  */
 
@@ -49,8 +66,12 @@
 #include <eulercpp/input/input.hpp>
 #include <eulercpp/input/input_helpers.hpp>
 #include <eulercpp/input/load_numerical.hpp>
+#include <eulercpp/math/block_sparse.hpp>
+#include <eulercpp/math/gradients.hpp>
 #include <eulercpp/math/limiters.hpp>
+#include <eulercpp/math/multigrid.hpp>
 #include <eulercpp/math/reconstruction.hpp>
+#include <eulercpp/math/solution_update.hpp>
 #include <eulercpp/physics/riemann.hpp>
 
 namespace eulercpp {
@@ -84,6 +105,12 @@ void load_numerical(
     if (it != config.end())
         input.numerical.CFL = std::stod(it->second);
 
+    it = config.find("CFL_max");
+    if (it != config.end())
+        input.numerical.CFL_max = std::stod(it->second);
+
+    const auto ramp_it = config.find("cfl_ramp");
+
     it = config.find("maxtime");
     if (it != config.end())
         input.numerical.maxtime = std::stod(it->second);
@@ -92,12 +119,22 @@ void load_numerical(
     if (it != config.end())
         input.numerical.maxiter = std::stoi(it->second);
 
+    it = config.find("local_timestep");
+    if (it != config.end())
+        input.numerical.local_timestep = std::stoi(it->second) != 0;
+
     it = config.find("reconstruction");
     if (it != config.end())
         input.numerical.reconstruction = static_cast<math::Reconstruction>(
             std::stoi(it->second)
         );
 
+    it = config.find("gradient");
+    if (it != config.end())
+        input.numerical.gradient = static_cast<math::Gradient>(
+            std::stoi(it->second)
+        );
+
     it = config.find("limiter");
     if (it != config.end())
         input.numerical.limiter = static_cast<math::Limiter>(
@@ -110,6 +147,83 @@ void load_numerical(
             std::stoi(it->second)
         );
 
+    it = config.find("preconditioner");
+    if (it != config.end())
+        input.numerical.preconditioner = static_cast<math::Preconditioner>(
+            std::stoi(it->second)
+        );
+
+    it = config.find("krylov_dim");
+    if (it != config.end())
+        input.numerical.krylov_dim = std::stoi(it->second);
+
+    it = config.find("krylov_tol");
+    if (it != config.end())
+        input.numerical.krylov_tol = std::stod(it->second);
+
+    it = config.find("residual_smoothing");
+    if (it != config.end())
+        input.numerical.residual_smoothing = std::stod(it->second);
+
+    it = config.find("smoothing_sweeps");
+    if (it != config.end())
+        input.numerical.smoothing_sweeps = std::stoi(it->second);
+
+    it = config.find("multigrid_levels");
+    if (it != config.end())
+        input.numerical.multigrid_levels = std::stoi(it->second);
+
+    it = config.find("multigrid_cycle");
+    if (it != config.end())
+        input.numerical.multigrid_cycle = static_cast<math::Cycle>(
+            std::stoi(it->second)
+        );
+
+    it = config.find("snapshot_delay");
+    if (it != config.end())
+        input.numerical.snapshot_delay = std::stoi(it->second);
+
+    it = config.find("rollback_attempts");
+    if (it != config.end())
+        input.numerical.rollback_attempts = std::stoi(it->second);
+
+    it = config.find("time_integration");
+    if (it != config.end())
+        input.numerical.time_integration = static_cast<math::TimeIntegration>(
+            std::stoi(it->second)
+        );
+
+    /// The CFL controller is part of the Newton-Krylov method by default
+    if (ramp_it != config.end()) {
+        input.numerical.cfl_ramp = std::stoi(ramp_it->second) != 0;
+    } else {
+        input.numerical.cfl_ramp = input.numerical.time_integration ==
+                                   math::TimeIntegration::NEWTON_KRYLOV;
+    }
+
+    /// Multigrid accelerates explicit steady-state runs
+    if (input.numerical.multigrid_levels > 0) {
+        if (input.numerical.time_integration !=
+            math::TimeIntegration::EXPLICIT) {
+            throw std::invalid_argument(
+                "Multigrid requires explicit time integration."
+            );
+        }
+        it = config.find("local_timestep");
+        if (it != config.end() && std::stoi(it->second) == 0) {
+            throw std::invalid_argument(
+                "Multigrid requires local time stepping."
+            );
+        }
+        input.numerical.local_timestep = true;
+    }
+
+    /// Implicit schemes are single-stage, with local time steps
+    if (input.numerical.time_integration != math::TimeIntegration::EXPLICIT) {
+        input.numerical.time_stages = 1;
+        input.numerical.local_timestep = true;
+    }
+
     if (input.numerical.time_stages == 1) {
         input.numerical.a.clear();
         input.numerical.a.push_back(1.0);
@@ -24,8 +24,9 @@
  *
  * This file defines the `compute_gradients()` function that calculates
  * spatial gradients of conserved variables (density, momentum, energy)
- * for each element in a mesh. Gradients are computed using neighboring
- * elements and face-weight vectors.
+ * for each element in a mesh. Gradients are computed as a weighted sum
+ * of neighbor differences, with the least-squares coefficients or the
+ * Green-Gauss face area vectors precomputed by `compute_distances`.
  *
  * OpenMP is used to parallelize the computation over all mesh elements.
  *
@@ -41,54 +42,64 @@
 namespace eulercpp::math {
 
 /**
- * @brief Compute gradients of conserved variables in a simulation.
+ * @brief Compute gradients of conserved variables for a fixed dimension.
  *
  * Computes the gradients of all variables stored in `sim.fields.W`
- * for every element of the mesh. Gradients are calculated using
- * neighboring elements and face-weight vectors and stored in
- * `sim.fields.gradW`.
+ * for every element of the mesh. Gradients are calculated as weighted
+ * sums of neighbor differences, using the precomputed least-squares
+ * coefficients `csr.c` or the Green-Gauss unique face area vectors
+ * `csr.area`, and stored in `sim.fields.gradW`. Components beyond `Dim`
+ * are set to zero.
  *
+ * @tparam Dim Spatial dimension (1, 2 or 3).
  * @param sim Reference to the Simulation containing mesh and fields.
  *
  * @note The computation is parallelized over mesh elements using OpenMP.
  */
+template <int Dim>
 void compute_gradients(Simulation& sim) {
     const Mesh& mesh = sim.mesh;
+    const Connectivity& csr = mesh.csr;
     Fields& fields = sim.fields;
 
     const int n_elements = mesh.n_elements;
     const int n_var = 5;
-    const int dim = fields.dimension();
+    const bool green_gauss =
+        sim.input.numerical.gradient == Gradient::GREEN_GAUSS;
+
+    fields.init_gradients();
 
     #pragma omp parallel for
     for (int i = 0; i < n_elements; ++i) {
-        const auto& elem = mesh.elements[i];
-        const auto& S = elem.S;
-        const auto& w = elem.w;
-        const auto& neighbors = elem.neighbors;
-        const int n_f = elem.n_faces;
-        std::array<double, 3> b;
+        const int begin = csr.begin(i);
+        const int end = csr.end(i);
         std::array<double, 3> g;
 
         for (int v = 0; v < n_var; ++v) {
             const double W = fields.W(i, v);
 
-            b = {0.0, 0.0, 0.0};
-            for (int f = 0; f < n_f; ++f) {
-                const int n = neighbors[f];
+            g = {0.0, 0.0, 0.0};
+            for (int s = begin; s < end; ++s) {
+                const int n = csr.neighbors[s];
                 if (n < 0) continue;
                 const double dW = fields.W(n, v) - W;
-                for (int d = 0; d < dim; ++d) b[d] += w[f][d] * dW;
+                if (green_gauss) {
+                    const auto& S = csr.area[csr.unique[s]];
+                    const double w =
+                        csr.sign[s] * csr.half_inv_volume[i] * dW;
+                    for (int d = 0; d < Dim; ++d) g[d] += S[d] * w;
+                } else {
+                    for (int d = 0; d < Dim; ++d) g[d] += csr.c[s][d] * dW;
+                }
             }
 
-            g = {0.0, 0.0, 0.0};
-            for (int d = 0; d < dim; ++d)
-                for (int e = 0; e < dim; ++e)
-                    g[d] += S[d][e] * b[e];
-
             fields.gradW(i, v) = g;
         }
     }
 }
 
+template void compute_gradients<1>(Simulation&);
+template void compute_gradients<2>(Simulation&);
+template void compute_gradients<3>(Simulation&);
+
 } // namespace eulercpp::math
@@ -0,0 +1,186 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file lusgs.cpp
+ * @brief Implementation of the matrix-free LU-SGS time integration.
+ *
+ * With a Rusanov splitting of the first-order flux, the implicit operator
+ * of cell i reads
+ *
+ *     D_i dW_i + sum_j 0.5 A_ij (dF_j . n_ij - omega lambda_ij dW_j) = b_i
+ *
+ * with `D_i = V_i / dt_i + 0.5 omega sum_j lambda_ij A_ij` and
+ * `dF_j = F(W_j + dW_j) - F(W_j)`, evaluated matrix-free. The forward
+ * sweep uses the neighbors already visited (lower indices), the backward
+ * sweep those with higher indices. The sweeps are inherently sequential.
+ *
+ * @see lusgs.hpp
+ *
+ * @author Alessio Improta
+ */
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <eulercpp/math/lusgs.hpp>
+#include <eulercpp/math/solution_update.hpp>
+#include <eulercpp/physics/fluxes.hpp>
+#include <eulercpp/simulation/simulation.hpp>
+
+namespace eulercpp::math {
+
+/** @brief Over-relaxation of the spectral radii (1 < omega <= 2). */
+static constexpr double omega = 1.5;
+
+/** @brief Solution increments, five per cell. */
+static std::vector<double> dW;
+
+/** @brief Diagonal of the implicit operator, per cell. */
+static std::vector<double> diag;
+
+/** @brief Face spectral radius times area, per CSR slot. */
+static std::vector<double> lambda_area;
+
+/**
+ * @brief Off-diagonal contribution of neighbor j to the row of a cell.
+ *
+ * Adds `0.5 (A dF_j . n - omega lambda A dW_j)` to `r`.
+ *
+ * @param fields Simulation fields.
+ * @param j Neighbor cell.
+ * @param n Unit normal, outward of the current cell.
+ * @param area Face area.
+ * @param lam_area Face spectral radius times area.
+ * @param gam Specific heat ratio.
+ * @param r Accumulated contribution.
+ */
+static inline void add_neighbor(const Fields& fields, int j,
+                                const std::array<double, 3>& n,
+                                double area, double lam_area, double gam,
+                                double* r) {
+    double Wj[5], Wp[5], F0[5], F1[5];
+    const double* dWj = &dW[j * 5];
+    for (int v = 0; v < 5; ++v) {
+        Wj[v] = fields.W(j, v);
+        Wp[v] = Wj[v] + dWj[v];
+    }
+    physics::normal_flux(Wj, n, gam, F0);
+    physics::normal_flux(Wp, n, gam, F1);
+
+    for (int v = 0; v < 5; ++v) {
+        r[v] += 0.5 * (area * (F1[v] - F0[v]) - omega * lam_area * dWj[v]);
+    }
+}
+
+/**
+ * @brief Advances the solution by one implicit LU-SGS step.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void lusgs_update(Simulation& sim) {
+    const auto& mesh = sim.mesh;
+    const auto& csr = mesh.csr;
+    auto& fields = sim.fields;
+
+    const int n_elements = mesh.n_elements;
+    constexpr int n_var = 5;
+    const double gam = sim.input.fluid.gamma;
+
+    dW.resize(static_cast<std::size_t>(n_elements) * n_var);
+    diag.resize(n_elements);
+    lambda_area.resize(mesh.n_faces);
+
+    /// Forward sweep: (D + L) dW* = b
+    for (int i = 0; i < n_elements; ++i) {
+        const double ui = fields.P(i, prim::u);
+        const double vi = fields.P(i, prim::v);
+        const double wi = fields.P(i, prim::w);
+        const double ai = fields.P(i, prim::a);
+
+        double r[n_var];
+        for (int v = 0; v < n_var; ++v) {
+            r[v] = fields.S(i, v);
+        }
+
+        double D = mesh.volumes[i] / fields.dt(i);
+        double lower[n_var] = {0.0};
+        for (int s = csr.begin(i); s < csr.end(i); ++s) {
+            const Face& face = mesh.faces[s];
+            const auto& n = face.normal;
+            const int j = csr.neighbors[s];
+
+            /// Residual from the current fluxes
+            const double sign = csr.sign[s];
+            const int u = csr.unique[s];
+            for (int v = 0; v < n_var; ++v) {
+                r[v] -= sign * fields.F(u, v);
+            }
+
+            double lam = std::abs(ui*n[0] + vi*n[1] + wi*n[2]) + ai;
+            if (j >= 0) {
+                const double lam_j = std::abs(
+                    fields.P(j, prim::u) * n[0] +
+                    fields.P(j, prim::v) * n[1] +
+                    fields.P(j, prim::w) * n[2]
+                ) + fields.P(j, prim::a);
+                lam = std::max(lam, lam_j);
+            }
+            lambda_area[s] = lam * face.area;
+            D += 0.5 * omega * lambda_area[s];
+
+            if (j >= 0 && j < i) {
+                add_neighbor(fields, j, n, face.area, lambda_area[s], gam,
+                             lower);
+            }
+        }
+
+        diag[i] = D;
+        for (int v = 0; v < n_var; ++v) {
+            const double b = std::isnan(r[v]) ? 0.0 : r[v];
+            fields.b(i, v) = b;
+            dW[i * n_var + v] = (b - lower[v]) / D;
+        }
+    }
+
+    /// Backward sweep: (D + U) dW = D dW*
+    for (int i = n_elements - 1; i >= 0; --i) {
+        double upper[n_var] = {0.0};
+        bool coupled = false;
+        for (int s = csr.begin(i); s < csr.end(i); ++s) {
+            const int j = csr.neighbors[s];
+            if (j <= i) continue;
+            const Face& face = mesh.faces[s];
+            add_neighbor(fields, j, face.normal, face.area, lambda_area[s],
+                         gam, upper);
+            coupled = true;
+        }
+        if (!coupled) continue;
+
+        for (int v = 0; v < n_var; ++v) {
+            dW[i * n_var + v] -= upper[v] / diag[i];
+        }
+    }
+
+    apply_increment(sim, dW);
+}
+
+} // namespace eulercpp::math
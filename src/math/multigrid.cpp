@@ -0,0 +1,629 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file multigrid.cpp
+ * @brief Implementation of the agglomeration multigrid.
+ *
+ * Level 0 is the face graph of the mesh; each coarse level fuses every
+ * free element (seed) with its free neighbors, and isolated seeds are
+ * merged into the smallest neighboring agglomerate. Coarse faces sum the
+ * area vectors of the fine faces they replace, so that the central part
+ * of the flux is exact for uniform states.
+ *
+ * On coarse levels the residual is a first-order Rusanov discretization.
+ * Boundary fluxes are reflective (walls, symmetry, axis) or extrapolated
+ * from the cell state; supersonic inlets, whose flux does not depend on
+ * the solution, and source terms are frozen in the FAS forcing term
+ *
+ *     P_c = sum(b_f) - b_c(W_c^0)
+ *
+ * so that the coarse problem `b_c(W_c) + P_c = 0` is satisfied by the
+ * restricted fine solution once the fine level has converged.
+ *
+ * @see multigrid.hpp
+ *
+ * @author Alessio Improta
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <eulercpp/input/load_bc.hpp>
+#include <eulercpp/math/multigrid.hpp>
+#include <eulercpp/math/solution_update.hpp>
+#include <eulercpp/output/logger.hpp>
+#include <eulercpp/physics/fluxes.hpp>
+#include <eulercpp/physics/sources.hpp>
+#include <eulercpp/simulation/pipeline.hpp>
+#include <eulercpp/simulation/simulation.hpp>
+
+namespace eulercpp::math {
+
+/**
+ * @struct Level
+ * @brief Face graph and state of a multigrid level.
+ *
+ * Interior faces are oriented from `left` to `right`; boundary faces
+ * belong to `bnd_cell`. States are stored five entries per cell, cell by
+ * cell. Level 0 (the mesh) only stores the graph.
+ */
+struct Level {
+    int n_cells = 0;                /**< Number of cells. */
+    std::vector<int> parent;        /**< Cell of each finer-level cell. */
+    std::vector<double> volumes;    /**< Cell volumes. */
+
+    std::vector<int> left;                  /**< Left cell of each face. */
+    std::vector<int> right;                 /**< Right cell of each face. */
+    std::vector<std::array<double, 3>> S;   /**< Summed area vectors. */
+    std::vector<double> area;               /**< Summed face areas. */
+
+    std::vector<int> bnd_cell;                  /**< Boundary face cell. */
+    std::vector<std::array<double, 3>> bnd_S;   /**< Boundary area vectors. */
+    std::vector<double> bnd_area;               /**< Boundary face areas. */
+    std::vector<char> bnd_wall;                 /**< Reflective boundary. */
+
+    std::vector<int> offsets;       /**< First face of each cell (n+1). */
+    std::vector<int> faces;         /**< Interior faces of each cell. */
+    std::vector<int> bnd_offsets;   /**< First boundary face of each cell. */
+    std::vector<int> bnd_faces;     /**< Boundary faces of each cell. */
+
+    std::vector<double> W;          /**< Current solution. */
+    std::vector<double> W0;         /**< Restricted solution. */
+    std::vector<double> Ws;         /**< Solution at the smoother start. */
+    std::vector<double> forcing;    /**< FAS forcing term. */
+    std::vector<double> rhs;        /**< Right-hand side b(W). */
+    std::vector<double> dt;         /**< Local time steps. */
+    std::vector<double> flux;       /**< Interior face fluxes. */
+    std::vector<double> bnd_flux;   /**< Boundary face fluxes. */
+};
+
+/** @brief Multigrid levels, level 0 being the mesh. */
+static std::vector<Level> levels;
+
+/** @brief Fine-level right-hand side. */
+static std::vector<double> fine_rhs;
+
+/**
+ * @brief Builds the cell-to-face connectivity of a level.
+ *
+ * Faces are listed in increasing order within each cell.
+ *
+ * @param L Level with faces already defined.
+ */
+static void build_connectivity(Level& L) {
+    const int n_faces = static_cast<int>(L.left.size());
+    const int n_bnd = static_cast<int>(L.bnd_cell.size());
+
+    L.offsets.assign(L.n_cells + 1, 0);
+    for (int f = 0; f < n_faces; ++f) {
+        L.offsets[L.left[f] + 1]++;
+        L.offsets[L.right[f] + 1]++;
+    }
+    L.bnd_offsets.assign(L.n_cells + 1, 0);
+    for (int f = 0; f < n_bnd; ++f) {
+        L.bnd_offsets[L.bnd_cell[f] + 1]++;
+    }
+    for (int i = 0; i < L.n_cells; ++i) {
+        L.offsets[i + 1] += L.offsets[i];
+        L.bnd_offsets[i + 1] += L.bnd_offsets[i];
+    }
+
+    std::vector<int> fill(L.offsets.begin(), L.offsets.end() - 1);
+    L.faces.resize(L.offsets.back());
+    for (int f = 0; f < n_faces; ++f) {
+        L.faces[fill[L.left[f]]++] = f;
+        L.faces[fill[L.right[f]]++] = f;
+    }
+
+    fill.assign(L.bnd_offsets.begin(), L.bnd_offsets.end() - 1);
+    L.bnd_faces.resize(n_bnd);
+    for (int f = 0; f < n_bnd; ++f) {
+        L.bnd_faces[fill[L.bnd_cell[f]]++] = f;
+    }
+}
+
+/**
+ * @brief Builds the face graph of the mesh (level 0).
+ *
+ * @param sim Reference to the Simulation object.
+ * @return Level without state.
+ */
+static Level mesh_level(const Simulation& sim) {
+    const auto& mesh = sim.mesh;
+    const auto& boundaries = sim.input.bc.boundaries;
+
+    Level L;
+    L.n_cells = mesh.n_elements;
+    L.volumes = mesh.volumes;
+
+    for (int u = 0; u < mesh.n_unique_faces; ++u) {
+        const auto& uface = mesh.unique_faces[u];
+        const Face& face = mesh.faces[uface.left];
+        const std::array<double, 3> S = {
+            face.normal[0] * face.area,
+            face.normal[1] * face.area,
+            face.normal[2] * face.area
+        };
+
+        if (uface.right != -1) {
+            L.left.push_back(uface.owner);
+            L.right.push_back(uface.neighbor);
+            L.S.push_back(S);
+            L.area.push_back(face.area);
+            continue;
+        }
+
+        if (face.flag < 0 ||
+            face.flag >= static_cast<int>(boundaries.size())) {
+            throw std::runtime_error(
+                "Invalid boundary id " + std::to_string(face.flag) +
+                " on face " + std::to_string(uface.left) + "."
+            );
+        }
+
+        using physics::BCType;
+        const BCType type = boundaries[face.flag].type;
+        if (type == BCType::SUPERSONIC_INLET) continue;
+
+        const bool wall = type == BCType::WALL ||
+                          type == BCType::SYMMETRY ||
+                          type == BCType::SLIPWALL ||
+                          type == BCType::MOVING_WALL ||
+                          type == BCType::AXIS;
+        L.bnd_cell.push_back(uface.owner);
+        L.bnd_S.push_back(S);
+        L.bnd_area.push_back(face.area);
+        L.bnd_wall.push_back(wall);
+    }
+
+    build_connectivity(L);
+    return L;
+}
+
+/**
+ * @brief Agglomerates a level into the next coarser one.
+ *
+ * @param fine Finer level.
+ * @return Coarse level, with state arrays allocated.
+ */
+static Level coarsen(const Level& fine) {
+    constexpr int n_var = 5;
+
+    Level C;
+    C.parent.assign(fine.n_cells, -1);
+    std::vector<int> size;
+
+    /// Seeds fused with their free neighbors
+    for (int i = 0; i < fine.n_cells; ++i) {
+        if (C.parent[i] != -1) continue;
+
+        const int c = C.n_cells++;
+        C.parent[i] = c;
+        size.push_back(1);
+        for (int k = fine.offsets[i]; k < fine.offsets[i + 1]; ++k) {
+            const int f = fine.faces[k];
+            const int j = fine.left[f] == i ? fine.right[f] : fine.left[f];
+            if (C.parent[j] == -1) {
+                C.parent[j] = c;
+                size[c]++;
+            }
+        }
+        if (size[c] > 1) continue;
+
+        /// Isolated seed: join the smallest neighboring agglomerate
+        int best = -1;
+        for (int k = fine.offsets[i]; k < fine.offsets[i + 1]; ++k) {
+            const int f = fine.faces[k];
+            const int j = fine.left[f] == i ? fine.right[f] : fine.left[f];
+            const int cj = C.parent[j];
+            if (cj == c) continue;
+            if (best == -1 || size[cj] < size[best] ||
+                (size[cj] == size[best] && cj < best)) {
+                best = cj;
+            }
+        }
+        if (best != -1) {
+            C.parent[i] = best;
+            size[best]++;
+            size.pop_back();
+            C.n_cells--;
+        }
+    }
+
+    C.volumes.assign(C.n_cells, 0.0);
+    for (int i = 0; i < fine.n_cells; ++i) {
+        C.volumes[C.parent[i]] += fine.volumes[i];
+    }
+
+    /// Interior faces: fine faces between different agglomerates, merged
+    std::vector<std::tuple<int, int, int>> keys;
+    for (int f = 0; f < static_cast<int>(fine.left.size()); ++f) {
+        const int a = C.parent[fine.left[f]];
+        const int b = C.parent[fine.right[f]];
+        if (a == b) continue;
+        keys.emplace_back(std::min(a, b), std::max(a, b), f);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    for (std::size_t k = 0; k < keys.size(); ++k) {
+        const auto [a, b, f] = keys[k];
+        const double sign = C.parent[fine.left[f]] == a ? 1.0 : -1.0;
+        if (k == 0 || std::get<0>(keys[k - 1]) != a ||
+                      std::get<1>(keys[k - 1]) != b) {
+            C.left.push_back(a);
+            C.right.push_back(b);
+            C.S.push_back({0.0, 0.0, 0.0});
+            C.area.push_back(0.0);
+        }
+        for (int d = 0; d < 3; ++d) {
+            C.S.back()[d] += sign * fine.S[f][d];
+        }
+        C.area.back() += fine.area[f];
+    }
+
+    /// Boundary faces: merged per agglomerate and boundary kind
+    keys.clear();
+    for (int f = 0; f < static_cast<int>(fine.bnd_cell.size()); ++f) {
+        keys.emplace_back(C.parent[fine.bnd_cell[f]], fine.bnd_wall[f], f);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    for (std::size_t k = 0; k < keys.size(); ++k) {
+        const auto [c, wall, f] = keys[k];
+        if (k == 0 || std::get<0>(keys[k - 1]) != c ||
+                      std::get<1>(keys[k - 1]) != wall) {
+            C.bnd_cell.push_back(c);
+            C.bnd_S.push_back({0.0, 0.0, 0.0});
+            C.bnd_area.push_back(0.0);
+            C.bnd_wall.push_back(static_cast<char>(wall));
+        }
+        for (int d = 0; d < 3; ++d) {
+            C.bnd_S.back()[d] += fine.bnd_S[f][d];
+        }
+        C.bnd_area.back() += fine.bnd_area[f];
+    }
+
+    build_connectivity(C);
+
+    const std::size_t n = static_cast<std::size_t>(C.n_cells) * n_var;
+    C.W.resize(n);
+    C.W0.resize(n);
+    C.Ws.resize(n);
+    C.forcing.resize(n);
+    C.rhs.resize(n);
+    C.dt.resize(C.n_cells);
+    C.flux.resize(C.left.size() * n_var);
+    C.bnd_flux.resize(C.bnd_cell.size() * n_var);
+    return C;
+}
+
+/**
+ * @brief Spectral radius `|u.n| + a` of a state along an area vector.
+ */
+static inline double spectral_radius(const double* W,
+                                     const std::array<double, 3>& S,
+                                     double gam) {
+    const double inv_rho = 1.0 / W[0];
+    const double u = W[1] * inv_rho;
+    const double v = W[2] * inv_rho;
+    const double w = W[3] * inv_rho;
+    const double p = (gam - 1.0) * (W[4] - 0.5 * W[0] * (u*u + v*v + w*w));
+    const double a = std::sqrt(gam * p * inv_rho);
+
+    const double S_norm = std::sqrt(S[0]*S[0] + S[1]*S[1] + S[2]*S[2]);
+    if (S_norm == 0.0) {
+        return std::sqrt(u*u + v*v + w*w) + a;
+    }
+    return std::abs(u*S[0] + v*S[1] + w*S[2]) / S_norm + a;
+}
+
+/**
+ * @brief Checks that a conservative state has positive density and
+ * pressure.
+ */
+static inline bool is_physical(const double* W, double gam) {
+    const double K = 0.5 * (W[1]*W[1] + W[2]*W[2] + W[3]*W[3]) / W[0];
+    return W[0] > 0.0 && (gam - 1.0) * (W[4] - K) > 0.0 &&
+           std::isfinite(W[4]);
+}
+
+/**
+ * @brief Evaluates the coarse right-hand side `b(W)` of a level.
+ *
+ * Optionally computes the local time steps of the current state.
+ *
+ * @param L Coarse level.
+ * @param gam Specific heat ratio.
+ * @param cfl CFL number, used if `timestep` is true.
+ * @param timestep Whether to update the local time steps.
+ */
+static void compute_rhs(Level& L, double gam, double cfl, bool timestep) {
+    constexpr int n_var = 5;
+    const int n_faces = static_cast<int>(L.left.size());
+    const int n_bnd = static_cast<int>(L.bnd_cell.size());
+
+    #pragma omp parallel for
+    for (int f = 0; f < n_faces; ++f) {
+        const double* WL = &L.W[L.left[f] * n_var];
+        const double* WR = &L.W[L.right[f] * n_var];
+        double FL[n_var], FR[n_var];
+        physics::normal_flux(WL, L.S[f], gam, FL);
+        physics::normal_flux(WR, L.S[f], gam, FR);
+
+        const double lam = std::max(spectral_radius(WL, L.S[f], gam),
+                                    spectral_radius(WR, L.S[f], gam));
+        for (int v = 0; v < n_var; ++v) {
+            L.flux[f * n_var + v] = 0.5 * (FL[v] + FR[v]) -
+                                    0.5 * lam * L.area[f] * (WR[v] - WL[v]);
+        }
+    }
+
+    #pragma omp parallel for
+    for (int f = 0; f < n_bnd; ++f) {
+        const double* W = &L.W[L.bnd_cell[f] * n_var];
+        double* F = &L.bnd_flux[f * n_var];
+        if (L.bnd_wall[f]) {
+            const double p = (gam - 1.0) * (W[4] - 0.5 *
+                (W[1]*W[1] + W[2]*W[2] + W[3]*W[3]) / W[0]);
+            F[0] = 0.0;
+            F[1] = p * L.bnd_S[f][0];
+            F[2] = p * L.bnd_S[f][1];
+            F[3] = p * L.bnd_S[f][2];
+            F[4] = 0.0;
+        } else {
+            physics::normal_flux(W, L.bnd_S[f], gam, F);
+        }
+    }
+
+    #pragma omp parallel for
+    for (int i = 0; i < L.n_cells; ++i) {
+        const double* Wi = &L.W[i * n_var];
+        double r[n_var] = {0.0};
+        double l_sum = 0.0;
+
+        for (int k = L.offsets[i]; k < L.offsets[i + 1]; ++k) {
+            const int f = L.faces[k];
+            const double sign = L.left[f] == i ? 1.0 : -1.0;
+            for (int v = 0; v < n_var; ++v) {
+                r[v] -= sign * L.flux[f * n_var + v];
+            }
+            if (timestep) {
+                l_sum += spectral_radius(Wi, L.S[f], gam) * L.area[f];
+            }
+        }
+        for (int k = L.bnd_offsets[i]; k < L.bnd_offsets[i + 1]; ++k) {
+            const int f = L.bnd_faces[k];
+            for (int v = 0; v < n_var; ++v) {
+                r[v] -= L.bnd_flux[f * n_var + v];
+            }
+            if (timestep) {
+                l_sum += spectral_radius(Wi, L.bnd_S[f], gam) * L.bnd_area[f];
+            }
+        }
+
+        for (int v = 0; v < n_var; ++v) {
+            L.rhs[i * n_var + v] = std::isnan(r[v]) ? 0.0 : r[v];
+        }
+        if (timestep) {
+            L.dt[i] = cfl * L.volumes[i] / (0.5 * l_sum);
+        }
+    }
+}
+
+/**
+ * @brief One multi-stage Runge-Kutta iteration of the forced coarse
+ * problem, with local time steps.
+ *
+ * Cells reaching an unphysical state keep their value at the start of
+ * the iteration.
+ *
+ * @param L Coarse level.
+ * @param a Runge-Kutta coefficients.
+ * @param gam Specific heat ratio.
+ * @param cfl CFL number.
+ */
+static void smooth(Level& L, const std::vector<double>& a, double gam,
+                   double cfl) {
+    constexpr int n_var = 5;
+    L.Ws = L.W;
+
+    for (std::size_t k = 0; k < a.size(); ++k) {
+        compute_rhs(L, gam, cfl, k == 0);
+
+        #pragma omp parallel for
+        for (int i = 0; i < L.n_cells; ++i) {
+            const double c = a[k] * L.dt[i] / L.volumes[i];
+            double Wn[n_var];
+            for (int v = 0; v < n_var; ++v) {
+                const int q = i * n_var + v;
+                Wn[v] = L.Ws[q] + c * (L.rhs[q] + L.forcing[q]);
+            }
+            const bool physical = is_physical(Wn, gam);
+            for (int v = 0; v < n_var; ++v) {
+                const int q = i * n_var + v;
+                L.W[q] = physical ? Wn[v] : L.Ws[q];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Sets the initial state and forcing term of a coarse level.
+ *
+ * `W` and `forcing` must hold the volume-weighted sum of the finer
+ * solution and the sum of the finer residual, respectively.
+ *
+ * @param L Coarse level.
+ * @param gam Specific heat ratio.
+ */
+static void start_level(Level& L, double gam) {
+    constexpr int n_var = 5;
+
+    #pragma omp parallel for
+    for (int i = 0; i < L.n_cells; ++i) {
+        for (int v = 0; v < n_var; ++v) {
+            L.W[i * n_var + v] /= L.volumes[i];
+        }
+    }
+    L.W0 = L.W;
+
+    compute_rhs(L, gam, 0.0, false);
+
+    #pragma omp parallel for
+    for (int q = 0; q < L.n_cells * n_var; ++q) {
+        L.forcing[q] -= L.rhs[q];
+    }
+}
+
+/**
+ * @brief FAS cycle starting on coarse level `l`.
+ *
+ * @param l Level index (>= 1).
+ * @param sim Reference to the Simulation object.
+ */
+static void cycle(std::size_t l, const Simulation& sim) {
+    constexpr int n_var = 5;
+    const auto& numerical = sim.input.numerical;
+    const double gam = sim.input.fluid.gamma;
+    const double cfl = sim.status.cfl;
+
+    Level& L = levels[l];
+    smooth(L, numerical.a, gam, cfl);
+    if (l + 1 == levels.size()) return;
+
+    /// Restriction of the solution and of the forced residual
+    Level& C = levels[l + 1];
+    compute_rhs(L, gam, cfl, false);
+    std::fill(C.W.begin(), C.W.end(), 0.0);
+    std::fill(C.forcing.begin(), C.forcing.end(), 0.0);
+    for (int i = 0; i < L.n_cells; ++i) {
+        const int c = C.parent[i];
+        for (int v = 0; v < n_var; ++v) {
+            const int q = i * n_var + v;
+            C.W[c * n_var + v] += L.volumes[i] * L.W[q];
+            C.forcing[c * n_var + v] += L.rhs[q] + L.forcing[q];
+        }
+    }
+    start_level(C, gam);
+
+    const int visits = numerical.multigrid_cycle == Cycle::W ? 2 : 1;
+    for (int k = 0; k < visits; ++k) {
+        cycle(l + 1, sim);
+    }
+
+    /// Prolongation of the correction by injection
+    #pragma omp parallel for
+    for (int i = 0; i < L.n_cells; ++i) {
+        const int c = C.parent[i];
+        double Wn[n_var];
+        for (int v = 0; v < n_var; ++v) {
+            Wn[v] = L.W[i * n_var + v] +
+                    C.W[c * n_var + v] - C.W0[c * n_var + v];
+        }
+        if (!is_physical(Wn, gam)) continue;
+        for (int v = 0; v < n_var; ++v) {
+            L.W[i * n_var + v] = Wn[v];
+        }
+    }
+}
+
+/**
+ * @brief Builds the coarse levels from the mesh connectivity.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void init_multigrid(const Simulation& sim) {
+    const int n_levels = sim.input.numerical.multigrid_levels;
+
+    levels.clear();
+    levels.push_back(mesh_level(sim));
+    for (int l = 1; l <= n_levels; ++l) {
+        const Level& fine = levels.back();
+        if (fine.left.empty()) break;
+
+        Level coarse = coarsen(fine);
+        if (coarse.n_cells == fine.n_cells) break;
+
+        Logger::info() << "Multigrid level " << l << ": "
+                       << coarse.n_cells << " elements.";
+        levels.push_back(std::move(coarse));
+    }
+
+    fine_rhs.resize(static_cast<std::size_t>(sim.mesh.n_elements) * 5);
+}
+
+/**
+ * @brief Runs one FAS cycle on the coarse levels.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void multigrid_cycle(Simulation& sim) {
+    constexpr int n_var = 5;
+    if (levels.size() < 2) return;
+
+    auto& fields = sim.fields;
+    const auto& volumes = sim.mesh.volumes;
+    const double gam = sim.input.fluid.gamma;
+
+    /// Fine residual at the smoothed solution
+    physics::update_sources(sim);
+    evaluate_residual(sim);
+    gather_rhs(sim, fine_rhs);
+
+    Level& C = levels[1];
+    std::fill(C.W.begin(), C.W.end(), 0.0);
+    std::fill(C.forcing.begin(), C.forcing.end(), 0.0);
+    for (int i = 0; i < sim.mesh.n_elements; ++i) {
+        const int c = C.parent[i];
+        for (int v = 0; v < n_var; ++v) {
+            C.W[c * n_var + v] += volumes[i] * fields.W(i, v);
+            C.forcing[c * n_var + v] += fine_rhs[i * n_var + v];
+        }
+    }
+    start_level(C, gam);
+
+    const int visits =
+        sim.input.numerical.multigrid_cycle == Cycle::W ? 2 : 1;
+    for (int k = 0; k < visits; ++k) {
+        cycle(1, sim);
+    }
+
+    #pragma omp parallel for
+    for (int i = 0; i < sim.mesh.n_elements; ++i) {
+        const int c = C.parent[i];
+        double Wn[n_var];
+        for (int v = 0; v < n_var; ++v) {
+            Wn[v] = fields.W(i, v) + C.W[c * n_var + v] - C.W0[c * n_var + v];
+        }
+        if (!is_physical(Wn, gam)) continue;
+        for (int v = 0; v < n_var; ++v) {
+            fields.W(i, v) = Wn[v];
+        }
+    }
+    fields.update_primitives();
+}
+
+} // namespace eulercpp::math
@@ -0,0 +1,398 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file newton_krylov.cpp
+ * @brief Implementation of the Jacobian-free Newton-Krylov integration.
+ *
+ * Each pseudo-time step solves
+ *
+ *     (V / dt + J) dW = b,    J = -db/dW
+ *
+ * with a single GMRES(m) cycle (no restart), right preconditioned and
+ * started from a zero initial guess. Products with J are first-order
+ * finite differences of the full residual pipeline (reconstruction,
+ * limiter, Riemann solver and boundary conditions):
+ *
+ *     J z = -(b(W + eps z) - b(W)) / eps
+ *
+ * The preconditioner approximates J by the first-order Rusanov Jacobian,
+ * with blocks `0.5 A (A_n(W_i) + lambda I)` on the diagonal and
+ * `0.5 A (A_n(W_j) - lambda I)` off the diagonal, factorized with
+ * block-Jacobi or ILU(0).
+ *
+ * @see newton_krylov.hpp
+ *
+ * @author Alessio Improta
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <eulercpp/math/block_sparse.hpp>
+#include <eulercpp/math/newton_krylov.hpp>
+#include <eulercpp/math/reduction.hpp>
+#include <eulercpp/math/solution_update.hpp>
+#include <eulercpp/output/logger.hpp>
+#include <eulercpp/physics/sources.hpp>
+#include <eulercpp/simulation/pipeline.hpp>
+#include <eulercpp/simulation/simulation.hpp>
+
+namespace eulercpp::math {
+
+/** @brief Relative size of the finite-difference perturbation. */
+static constexpr double fd_epsilon = 1.0e-7;
+
+/** @brief First-order Jacobian, factorized in place. */
+static BlockCSR jacobian;
+
+/** @brief Krylov basis, m + 1 vectors of five entries per cell. */
+static std::vector<std::vector<double>> basis;
+
+/** @brief Residual at the current solution, five entries per cell. */
+static std::vector<double> b0;
+
+/** @brief Work vectors: preconditioned direction and perturbed residual. */
+static std::vector<double> z, bz;
+
+/** @brief Solution increments, five per cell. */
+static std::vector<double> dW;
+
+/**
+ * @brief Jacobian of the inviscid flux projected on a unit normal.
+ *
+ * @param W Conservative state.
+ * @param n Unit normal.
+ * @param gam Specific heat ratio.
+ * @param A Output 5x5 block, row major.
+ */
+static void flux_jacobian(const double* W, const std::array<double, 3>& n,
+                          double gam, Block& A) {
+    const double g1 = gam - 1.0;
+    const double rho = W[0];
+    const double u[3] = {W[1] / rho, W[2] / rho, W[3] / rho};
+    const double un = u[0]*n[0] + u[1]*n[1] + u[2]*n[2];
+    const double q2 = u[0]*u[0] + u[1]*u[1] + u[2]*u[2];
+    const double phi = 0.5 * g1 * q2;
+    const double H = gam * W[4] / rho - phi;
+
+    A[0] = 0.0;
+    A[1] = n[0];
+    A[2] = n[1];
+    A[3] = n[2];
+    A[4] = 0.0;
+
+    for (int k = 0; k < 3; ++k) {
+        double* row = &A[(k + 1) * 5];
+        row[0] = phi * n[k] - u[k] * un;
+        for (int l = 0; l < 3; ++l) {
+            row[l + 1] = u[k] * n[l] - g1 * u[l] * n[k];
+        }
+        row[k + 1] += un;
+        row[4] = g1 * n[k];
+    }
+
+    double* row = &A[20];
+    row[0] = un * (phi - H);
+    for (int l = 0; l < 3; ++l) {
+        row[l + 1] = H * n[l] - g1 * u[l] * un;
+    }
+    row[4] = gam * un;
+}
+
+/**
+ * @brief Adds `scale * (A_n(W) + shift I)` to a block.
+ */
+static inline void add_jacobian(const double* W, const std::array<double, 3>& n,
+                                double gam, double scale, double shift,
+                                Block& block) {
+    Block A;
+    flux_jacobian(W, n, gam, A);
+    for (int k = 0; k < 25; ++k) {
+        block[k] += scale * A[k];
+    }
+    for (int k = 0; k < 5; ++k) {
+        block[k * 6] += scale * shift;
+    }
+}
+
+/**
+ * @brief Assembles the first-order preconditioning matrix.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+static void assemble_jacobian(Simulation& sim) {
+    const auto& mesh = sim.mesh;
+    const auto& csr = mesh.csr;
+    const auto& fields = sim.fields;
+    const double gam = sim.input.fluid.gamma;
+
+    jacobian.zero();
+
+    #pragma omp parallel for
+    for (int i = 0; i < mesh.n_elements; ++i) {
+        double Wi[5];
+        for (int v = 0; v < 5; ++v) {
+            Wi[v] = fields.W(i, v);
+        }
+        const double ui = fields.P(i, prim::u);
+        const double vi = fields.P(i, prim::v);
+        const double wi = fields.P(i, prim::w);
+        const double ai = fields.P(i, prim::a);
+
+        Block& diag = jacobian.blocks[jacobian.diagonal[i]];
+        const double V_dt = mesh.volumes[i] / fields.dt(i);
+        for (int k = 0; k < 5; ++k) {
+            diag[k * 6] += V_dt;
+        }
+
+        for (int s = csr.begin(i); s < csr.end(i); ++s) {
+            const Face& face = mesh.faces[s];
+            const auto& n = face.normal;
+            const int j = csr.neighbors[s];
+
+            double lam = std::abs(ui*n[0] + vi*n[1] + wi*n[2]) + ai;
+            if (j >= 0) {
+                const double lam_j = std::abs(
+                    fields.P(j, prim::u) * n[0] +
+                    fields.P(j, prim::v) * n[1] +
+                    fields.P(j, prim::w) * n[2]
+                ) + fields.P(j, prim::a);
+                lam = std::max(lam, lam_j);
+            }
+
+            const double half_area = 0.5 * face.area;
+            add_jacobian(Wi, n, gam, half_area, lam, diag);
+
+            if (j >= 0) {
+                double Wj[5];
+                for (int v = 0; v < 5; ++v) {
+                    Wj[v] = fields.W(j, v);
+                }
+                add_jacobian(Wj, n, gam, half_area, -lam,
+                             jacobian.blocks[jacobian.slot_block[s]]);
+            }
+        }
+    }
+
+    factorize(jacobian, sim.input.numerical.preconditioner);
+}
+
+/**
+ * @brief Sets the solution to `Wold + eps * x` (or `Wold` if x is null)
+ * and refreshes primitives and sources.
+ */
+static void set_state(Simulation& sim, const double* x, double eps) {
+    auto& fields = sim.fields;
+
+    #pragma omp parallel for
+    for (int i = 0; i < sim.mesh.n_elements; ++i) {
+        for (int v = 0; v < 5; ++v) {
+            fields.W(i, v) = fields.Wold(i, v) + (x ? eps * x[i * 5 + v] : 0.0);
+        }
+    }
+    fields.update_primitives();
+    physics::update_sources(sim);
+}
+
+/**
+ * @brief Deterministic dot product of two vectors.
+ */
+static double dot(const std::vector<double>& a, const std::vector<double>& b) {
+    return blocked_sum(static_cast<int>(a.size()),
+                       [&](int k) { return a[k] * b[k]; });
+}
+
+/**
+ * @brief Matrix-free product `y = (V / dt + J) x`.
+ *
+ * @param sim Reference to the Simulation object.
+ * @param x Input vector.
+ * @param y Output vector.
+ * @param W_scale Mean magnitude of the conservative variables.
+ */
+static void apply_operator(Simulation& sim, const std::vector<double>& x,
+                           std::vector<double>& y, double W_scale) {
+    const auto& mesh = sim.mesh;
+    const auto& fields = sim.fields;
+
+    const double x_norm = std::sqrt(dot(x, x));
+    if (x_norm == 0.0) {
+        std::fill(y.begin(), y.end(), 0.0);
+        return;
+    }
+    const double eps = fd_epsilon * (W_scale + 1.0) / x_norm;
+
+    set_state(sim, x.data(), eps);
+    evaluate_residual(sim);
+    gather_rhs(sim, bz);
+
+    #pragma omp parallel for
+    for (int i = 0; i < mesh.n_elements; ++i) {
+        const double V_dt = mesh.volumes[i] / fields.dt(i);
+        for (int v = 0; v < 5; ++v) {
+            const int k = i * 5 + v;
+            y[k] = V_dt * x[k] - (bz[k] - b0[k]) / eps;
+        }
+    }
+}
+
+/**
+ * @brief Advances the solution by one Newton-Krylov step.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void newton_krylov_update(Simulation& sim) {
+    const auto& mesh = sim.mesh;
+    const auto& numerical = sim.input.numerical;
+    auto& fields = sim.fields;
+
+    const int n_elements = mesh.n_elements;
+    const int n = n_elements * 5;
+    const int m = std::max(1, numerical.krylov_dim);
+
+    if (jacobian.n_rows != n_elements) {
+        jacobian.build(mesh.csr, n_elements);
+    }
+    basis.resize(m + 1);
+    for (auto& vec : basis) {
+        vec.resize(n);
+    }
+    b0.resize(n);
+    z.resize(n);
+    bz.resize(n);
+    dW.assign(n, 0.0);
+
+    /// Right-hand side at the current solution
+    gather_rhs(sim, b0);
+    #pragma omp parallel for
+    for (int i = 0; i < n_elements; ++i) {
+        for (int v = 0; v < 5; ++v) {
+            fields.b(i, v) = b0[i * 5 + v];
+        }
+    }
+
+    assemble_jacobian(sim);
+
+    const double W_scale = blocked_sum(n_elements, [&](int i) {
+        double sum = 0.0;
+        for (int v = 0; v < 5; ++v) {
+            sum += std::abs(fields.W(i, v));
+        }
+        return sum;
+    }) / n;
+
+    /// GMRES(m), zero initial guess, right preconditioned
+    const double beta = std::sqrt(dot(b0, b0));
+    std::vector<double> H((m + 1) * m, 0.0);
+    std::vector<double> cs(m), sn(m), g(m + 1, 0.0);
+    g[0] = beta;
+
+    int k = 0;
+    if (beta > 0.0) {
+        for (int q = 0; q < n; ++q) {
+            basis[0][q] = b0[q] / beta;
+        }
+
+        const double target = numerical.krylov_tol * beta;
+        for (; k < m; ++k) {
+            precondition(jacobian, numerical.preconditioner,
+                         basis[k].data(), z.data());
+            auto& w = basis[k + 1];
+            apply_operator(sim, z, w, W_scale);
+
+            /// Modified Gram-Schmidt
+            for (int j = 0; j <= k; ++j) {
+                const double h = dot(w, basis[j]);
+                H[j * m + k] = h;
+                #pragma omp parallel for
+                for (int q = 0; q < n; ++q) {
+                    w[q] -= h * basis[j][q];
+                }
+            }
+            const double h_next = std::sqrt(dot(w, w));
+            H[(k + 1) * m + k] = h_next;
+            if (h_next > 0.0) {
+                #pragma omp parallel for
+                for (int q = 0; q < n; ++q) {
+                    w[q] /= h_next;
+                }
+            }
+
+            /// Givens rotations
+            for (int j = 0; j < k; ++j) {
+                const double a = H[j * m + k];
+                const double c = H[(j + 1) * m + k];
+                H[j * m + k] = cs[j] * a + sn[j] * c;
+                H[(j + 1) * m + k] = -sn[j] * a + cs[j] * c;
+            }
+            const double a = H[k * m + k];
+            const double r = std::hypot(a, h_next);
+            if (r == 0.0) {
+                /// Breakdown: the new column vanishes, keep k directions
+                break;
+            }
+            cs[k] = a / r;
+            sn[k] = h_next / r;
+            H[k * m + k] = r;
+            H[(k + 1) * m + k] = 0.0;
+            g[k + 1] = -sn[k] * g[k];
+            g[k] = cs[k] * g[k];
+
+            if (std::abs(g[k + 1]) <= target || h_next == 0.0) {
+                ++k;
+                break;
+            }
+        }
+
+        /// Back substitution and dW = M^-1 (V y)
+        std::vector<double> y(k);
+        for (int j = k - 1; j >= 0; --j) {
+            double sum = g[j];
+            for (int l = j + 1; l < k; ++l) {
+                sum -= H[j * m + l] * y[l];
+            }
+            y[j] = sum / H[j * m + j];
+        }
+
+        #pragma omp parallel for
+        for (int q = 0; q < n; ++q) {
+            double sum = 0.0;
+            for (int j = 0; j < k; ++j) {
+                sum += y[j] * basis[j][q];
+            }
+            bz[q] = sum;
+        }
+        precondition(jacobian, numerical.preconditioner, bz.data(),
+                     dW.data());
+
+        Logger::debug() << "GMRES: " << k << " iterations, relative residual "
+                        << std::abs(g[k]) / beta;
+    }
+
+    /// Restore the fluxes of the current solution, then update it
+    set_state(sim, nullptr, 0.0);
+    evaluate_residual(sim);
+    apply_increment(sim, dW);
+}
+
+} // namespace eulercpp::math
@@ -26,14 +26,16 @@
  * - Piecewise constant reconstruction
  * - MUSCL reconstruction with slope limiting
  *
- * Provides public interfaces for initializing and invoking these schemes.
- * MUSCL reconstruction uses a limiter function to maintain monotonicity.
+ * MUSCL reconstruction uses a limiter function to maintain monotonicity,
+ * inlined at compile time. The MUSCL kernel also computes the gradients,
+ * in the same pass over the neighbors.
  *
  * @see reconstruction.hpp
  * @author Alessio Improta
  */
 
 #include <array>
+#include <vector>
 #include <omp.h>
 
 #include <eulercpp/math/reconstruction.hpp>
@@ -43,12 +45,6 @@
 
 namespace eulercpp::math {
 
-/** @brief Internal pointer to the current reconstruction scheme */
-static ReconstructionScheme reconstruction_scheme = nullptr;
-
-/** @brief Internal pointer to the limiter function for MUSCL */
-static LimiterFunction limiter = nullptr;
-
 /**
  * @brief Piecewise constant reconstruction.
  *
@@ -56,8 +52,7 @@ static LimiterFunction limiter = nullptr;
  *
  * @param sim Simulation object to update.
  */
-static inline void constant_reconstruction(eulercpp::Simulation& sim) {
-    const Input& input = sim.input;
+void constant_reconstruction(eulercpp::Simulation& sim) {
     const Mesh& mesh = sim.mesh;
     Fields& fields = sim.fields;
 
@@ -71,104 +66,168 @@ static inline void constant_reconstruction(eulercpp::Simulation& sim) {
 }
 
 /**
- * @brief MUSCL reconstruction with slope limiting.
+ * @brief Projects a gradient onto a cell-to-face distance.
+ *
+ * @tparam Dim Number of spatial components to use.
+ * @param g Gradient vector.
+ * @param d Distance vector.
+ * @return Dot product over the first `Dim` components.
+ */
+template <int Dim>
+static inline double project(const std::array<double, 3>& g,
+                             const std::array<double, 3>& d) {
+    double r = g[0] * d[0];
+    for (int k = 1; k < Dim; ++k) r += g[k] * d[k];
+    return r;
+}
+
+/**
+ * @brief Limits and writes the face values of one variable of a cell.
  *
- * Reconstructs face values using cell-centered gradients and a limiter
- * function to maintain monotonicity. The limiter ensures no spurious
- * oscillations occur near discontinuities.
+ * Computes the Barth-type limiting factor from the cell bounds and the
+ * gradient projected on each face, then writes the limited face values.
  *
+ * @tparam Dim Number of spatial gradient components.
+ * @tparam LimiterT Limiter callable, a function pointer or a functor.
+ * @param fields Fields receiving the face values.
+ * @param csr Element connectivity.
+ * @param i Index of the cell.
+ * @param v Index of the variable.
+ * @param W Cell value.
+ * @param Wmin Minimum over the cell and its neighbors.
+ * @param Wmax Maximum over the cell and its neighbors.
+ * @param gradW Cell gradient.
+ * @param limiter Limiter applied to the face difference ratio.
+ */
+template <int Dim, class LimiterT>
+static inline void limit_faces(Fields& fields, const Connectivity& csr,
+                               int i, int v, double W,
+                               double Wmin, double Wmax,
+                               const std::array<double, 3>& gradW,
+                               LimiterT limiter) {
+    const auto& df = csr.df;
+    const int begin = csr.begin(i);
+    const int end = csr.end(i);
+
+    const double Dmax = Wmax - W;
+    const double Dmin = Wmin - W;
+
+    double alpha = 1.0;
+
+    for (int s = begin; s < end; ++s) {
+        const double Df = project<Dim>(gradW, df[s]);
+
+        if ((Df >= 0.0 && Dmax < 1.0e-5) || (Df <= 0.0 && Dmin > -1.0e-5)) {
+            alpha = 0.0;
+            break;
+        }
+
+        const double rf = (Df > 0.0) ? Df / Dmax : Df / Dmin;
+        alpha = std::min(alpha, limiter(rf));
+    }
+
+    for (int s = begin; s < end; ++s) {
+        fields.Wf(s, v) = W + alpha * project<Dim>(gradW, df[s]);
+    }
+}
+
+/**
+ * @brief Fused gradient and MUSCL reconstruction.
+ *
+ * For each cell, the neighbor states are gathered once and used for the
+ * gradient, the min/max bounds, the limiter and the face
+ * values, so that neighbor data is read once per stage instead of twice
+ * and gradients are never stored. Results are identical to
+ * `compute_gradients` followed by MUSCL reconstruction.
+ *
+ * @tparam L Limiter type.
+ * @tparam Dim Spatial dimension (1, 2 or 3).
  * @param sim Simulation object to update.
  */
-static inline void muscl_reconstruction(eulercpp::Simulation& sim) {
-    const Input& input = sim.input;
+template <Limiter L, int Dim>
+void fused_muscl_reconstruction(eulercpp::Simulation& sim) {
     const Mesh& mesh = sim.mesh;
     Fields& fields = sim.fields;
 
+    const Connectivity& csr = mesh.csr;
+    const auto limiter = [](double rf) { return limit<L>(rf); };
+
     const int n_elements = mesh.n_elements;
     const int n_var = 5;
+    const bool green_gauss =
+        sim.input.numerical.gradient == Gradient::GREEN_GAUSS;
 
-    #pragma omp parallel for
-    for (int i = 0; i < n_elements; ++i) {
-        const auto& elem = mesh.elements[i];
-        const auto& df = elem.df;
-        const int n_f = elem.n_faces;
-
-        for (int v = 0; v < n_var; ++v) {
-            const double W = fields.W(i, v);
+    #pragma omp parallel
+    {
+        /// Neighbor states of the current cell, [local face][variable]
+        std::vector<double> Wn(csr.max_faces * n_var);
 
-            double Wmin = W;
-            double Wmax = W;
+        #pragma omp for
+        for (int i = 0; i < n_elements; ++i) {
+            const int begin = csr.begin(i);
+            const int end = csr.end(i);
 
-            for (int f = 0; f < n_f; ++f) {
-                const int n = elem.neighbors[f];
+            for (int s = begin; s < end; ++s) {
+                const int n = csr.neighbors[s];
                 if (n < 0) continue;
-
-                Wmax = std::max(Wmax, fields.W(n, v));
-                Wmin = std::min(Wmin, fields.W(n, v));
+                for (int v = 0; v < n_var; ++v) {
+                    Wn[(s - begin) * n_var + v] = fields.W(n, v);
+                }
             }
 
-            const double Dmax = Wmax - W;
-            const double Dmin = Wmin - W;
-
-            double alpha = 1.0;
-
-            for (int f = 0; f < n_f; ++f) {
-                const double Df = math::dot_product(fields.gradW(i, v), df[f]);
-
-                if ((Df >= 0.0 && Dmax < 1.0e-5) || (Df <= 0.0 && Dmin > -1.0e-5)) {
-                    alpha = 0.0;
-                    break;
+            for (int v = 0; v < n_var; ++v) {
+                const double W = fields.W(i, v);
+
+                double Wmin = W;
+                double Wmax = W;
+                std::array<double, 3> g = {0.0, 0.0, 0.0};
+
+                for (int s = begin; s < end; ++s) {
+                    if (csr.neighbors[s] < 0) continue;
+                    const double Wv = Wn[(s - begin) * n_var + v];
+
+                    const double dW = Wv - W;
+                    if (green_gauss) {
+                        const auto& S = csr.area[csr.unique[s]];
+                        const double w =
+                            csr.sign[s] * csr.half_inv_volume[i] * dW;
+                        for (int d = 0; d < Dim; ++d) g[d] += S[d] * w;
+                    } else {
+                        for (int d = 0; d < Dim; ++d) {
+                            g[d] += csr.c[s][d] * dW;
+                        }
+                    }
+
+                    Wmax = std::max(Wmax, Wv);
+                    Wmin = std::min(Wmin, Wv);
                 }
 
-                const double rf = (Df > 0.0) ? Df / Dmax : Df / Dmin;
-                alpha = std::min(alpha, limiter(rf));
-            }
-
-            for (int f = 0; f < n_f; ++f) {
-                const int fi = elem.faces[f];
-                fields.Wf(fi, v) = W + alpha * (math::dot_product(fields.gradW(i, v), df[f]));
+                limit_faces<Dim>(fields, csr, i, v, W, Wmin, Wmax, g, limiter);
             }
         }
     }
 }
 
-/**
- * @brief Applies the current reconstruction scheme to a simulation.
- *
- * Calls the function pointer set by `init_reconstruction`.
- *
- * @param sim Simulation object to apply reconstruction to.
- */
-void reconstruction(eulercpp::Simulation& sim) {
-    reconstruction_scheme(sim);
-}
-
-/**
- * @brief Initializes the reconstruction scheme.
- *
- * Maps the `Reconstruction` enum to the corresponding internal function.
- *
- * @param scheme Selected reconstruction scheme.
- * @throws std::invalid_argument if the scheme is unknown.
- */
-void init_reconstruction(Reconstruction scheme) {
-    switch (scheme) {
-        case Reconstruction::CONSTANT:  reconstruction_scheme = constant_reconstruction; break;
-        case Reconstruction::MUSCL:     reconstruction_scheme = muscl_reconstruction;    break;
-        default: throw std::invalid_argument("Unknown reconstruction scheme.");
-    }
-}
-
-/**
- * @brief Initializes the limiter function for MUSCL reconstruction.
- *
- * Must be called before using MUSCL reconstruction to ensure the limiter
- * function is set.
- *
- * @param type Limiter type.
- */
-void init_limiter(Limiter type) {
-    limiter = get_limiter(type);
-}
+template void fused_muscl_reconstruction<Limiter::MINMOD, 1>(Simulation&);
+template void fused_muscl_reconstruction<Limiter::MINMOD, 2>(Simulation&);
+template void fused_muscl_reconstruction<Limiter::MINMOD, 3>(Simulation&);
+template void fused_muscl_reconstruction<Limiter::SUPERBEE, 1>(Simulation&);
+template void fused_muscl_reconstruction<Limiter::SUPERBEE, 2>(Simulation&);
+template void fused_muscl_reconstruction<Limiter::SUPERBEE, 3>(Simulation&);
+template void fused_muscl_reconstruction<Limiter::VANLEER, 1>(Simulation&);
+template void fused_muscl_reconstruction<Limiter::VANLEER, 2>(Simulation&);
+template void fused_muscl_reconstruction<Limiter::VANLEER, 3>(Simulation&);
+template void
+fused_muscl_reconstruction<Limiter::VENKATAKRISHNAN, 1>(Simulation&);
+template void
+fused_muscl_reconstruction<Limiter::VENKATAKRISHNAN, 2>(Simulation&);
+template void
+fused_muscl_reconstruction<Limiter::VENKATAKRISHNAN, 3>(Simulation&);
+template void
+fused_muscl_reconstruction<Limiter::MODVENKATAKRISHNAN, 1>(Simulation&);
+template void
+fused_muscl_reconstruction<Limiter::MODVENKATAKRISHNAN, 2>(Simulation&);
+template void
+fused_muscl_reconstruction<Limiter::MODVENKATAKRISHNAN, 3>(Simulation&);
 
 } // namespace eulercpp::math
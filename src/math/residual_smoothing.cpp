@@ -0,0 +1,102 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file residual_smoothing.cpp
+ * @brief Implementation of the central implicit residual smoothing.
+ *
+ * Each Jacobi sweep reads the previous iterate from `fields.b` and writes
+ * the next one into a buffer, so the result does not depend on the order
+ * in which cells are visited or on the number of threads.
+ *
+ * @see residual_smoothing.hpp
+ *
+ * @author Alessio Improta
+ */
+
+#include <vector>
+
+#include <eulercpp/math/residual_smoothing.hpp>
+#include <eulercpp/simulation/simulation.hpp>
+
+namespace eulercpp::math {
+
+/** @brief Unsmoothed right-hand side, five entries per cell. */
+static std::vector<double> b_raw;
+
+/** @brief Next Jacobi iterate, five entries per cell. */
+static std::vector<double> b_next;
+
+/**
+ * @brief Smooths `fields.b` in place.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void smooth_residual(Simulation& sim) {
+    const auto& mesh = sim.mesh;
+    const auto& csr = mesh.csr;
+    auto& fields = sim.fields;
+
+    const int n_elements = mesh.n_elements;
+    constexpr int n_var = 5;
+    const double eps = sim.input.numerical.residual_smoothing;
+    const int sweeps = sim.input.numerical.smoothing_sweeps;
+
+    b_raw.resize(static_cast<std::size_t>(n_elements) * n_var);
+    b_next.resize(b_raw.size());
+
+    #pragma omp parallel for
+    for (int i = 0; i < n_elements; ++i) {
+        for (int v = 0; v < n_var; ++v) {
+            b_raw[i * n_var + v] = fields.b(i, v);
+        }
+    }
+
+    for (int k = 0; k < sweeps; ++k) {
+        #pragma omp parallel for
+        for (int i = 0; i < n_elements; ++i) {
+            double sum[n_var] = {0.0};
+            int n_neighbors = 0;
+            for (int s = csr.begin(i); s < csr.end(i); ++s) {
+                const int j = csr.neighbors[s];
+                if (j < 0) continue;
+                for (int v = 0; v < n_var; ++v) {
+                    sum[v] += fields.b(j, v);
+                }
+                ++n_neighbors;
+            }
+
+            const double inv_diag = 1.0 / (1.0 + eps * n_neighbors);
+            for (int v = 0; v < n_var; ++v) {
+                const int q = i * n_var + v;
+                b_next[q] = (b_raw[q] + eps * sum[v]) * inv_diag;
+            }
+        }
+
+        #pragma omp parallel for
+        for (int i = 0; i < n_elements; ++i) {
+            for (int v = 0; v < n_var; ++v) {
+                fields.b(i, v) = b_next[i * n_var + v];
+            }
+        }
+    }
+}
+
+} // namespace eulercpp::math
@@ -36,8 +36,12 @@
  */
 
 #include <omp.h>
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
+#include <eulercpp/math/reduction.hpp>
+#include <eulercpp/math/residual_smoothing.hpp>
 #include <eulercpp/math/solution_update.hpp>
 #include <eulercpp/simulation/simulation.hpp>
 #include <eulercpp/output/logger.hpp>
@@ -58,7 +62,19 @@ static int inner_iter = 0;
  * This function updates the conservative variables of the simulation
  * based on the numerical fluxes and source terms. It supports multi-stage
  * time integration methods, using an internal counter to select the
- * appropriate stage coefficient.
+ * appropriate stage coefficient. With local time stepping each cell
+ * advances with its own time step `fields.dt(i)` instead of `status.dt`.
+ *
+ * The update is a single pass over the cells: each cell gathers its
+ * fluxes, updates W, refreshes its primitive cache, accumulates the
+ * L1/L2/Linf residual norms and, if the new state is unphysical, is
+ * added to `fields.unphysical_cells()` for `physics::apply_corrections`.
+ * Norms are reduced with `blocked_reduce`, so they do not depend on the
+ * number of threads.
+ *
+ * With implicit residual smoothing the pass is split in two: the
+ * right-hand side (and its norms) is gathered first, smoothed by
+ * `smooth_residual`, and then used to update the solution.
  *
  * @param sim Reference to the Simulation object containing
  *            mesh, fields, and numerical parameters.
@@ -70,29 +86,153 @@ void advance_solution(Simulation& sim) {
     auto& fields = sim.fields;
 
     const int n_elements = mesh.n_elements;
-    const int n_var = 5;
+    constexpr int n_var = 5;
     double dt = status.dt;
 
-    const auto& a = input.numerical.a;
-    #pragma omp parallel for
-    for (int i = 0; i < n_elements; ++i) {
-        const auto& elem = mesh.elements[i];
-        for (int v = 0; v < n_var; ++v) {
-            /// Sum flux contributions from all faces
-            double dF = 0.0;
-            for (int f = 0; f < elem.n_faces; ++f) {
-                int j = elem.faces[f];
-                dF += fields.F(j, v);
+    const auto& csr = mesh.csr;
+    const double* V = mesh.volumes.data();
+    const double a = input.numerical.a[inner_iter];
+    const double c = a * dt;
+    const bool local = input.numerical.local_timestep;
+    const bool smoothing = input.numerical.residual_smoothing > 0.0;
+
+    std::vector<int>& unphysical = fields.unphysical_cells();
+    unphysical.clear();
+
+    /// Sum flux contributions from all faces, with the source term
+    auto gather = [&](int i, Residuals& acc) {
+        double dF[n_var] = {0.0};
+        for (int s = csr.begin(i); s < csr.end(i); ++s) {
+            const double sign = csr.sign[s];
+            const int u = csr.unique[s];
+            for (int v = 0; v < n_var; ++v) {
+                dF[v] += sign * fields.F(u, v);
             }
-            /// Compute update with source term
-            fields.b(i, v) = std::isnan(fields.S(i, v) - dF) ? 0.0 : fields.S(i, v) - dF;
+        }
+
+        for (int v = 0; v < n_var; ++v) {
+            double b = fields.S(i, v) - dF[v];
+            b = std::isnan(b) ? 0.0 : b;
+            fields.b(i, v) = b;
+            acc.add(v, b);
+        }
+    };
+
+    /// Advance the solution, refresh the primitives and check the state
+    auto advance = [&](int i) {
+        const double cV = (local ? a * fields.dt(i) : c) / V[i];
+        for (int v = 0; v < n_var; ++v) {
+            fields.W(i, v) = fields.Wold(i, v) + cV * fields.b(i, v);
+        }
+
+        fields.update_primitives(i);
+        if (!fields.is_physical(i)) {
+            #pragma omp critical
+            unphysical.push_back(i);
+        }
+    };
 
-            /// Advance solution with stage coefficient
-            fields.W(i, v) = fields.Wold(i, v) + a[inner_iter] * dt / elem.volume * fields.b(i, v);
+    auto merge = [](Residuals& a, const Residuals& b) { a.merge(b); };
+
+    Residuals norms;
+    if (smoothing) {
+        /// Norms of the unsmoothed residual, then smoothed update
+        norms = blocked_reduce(n_elements, Residuals{}, gather, merge);
+        smooth_residual(sim);
+
+        #pragma omp parallel for
+        for (int i = 0; i < n_elements; ++i) {
+            advance(i);
         }
+    } else {
+        norms = blocked_reduce(
+            n_elements, Residuals{},
+            [&](int i, Residuals& acc) { gather(i, acc); advance(i); },
+            merge
+        );
     }
+    norms.finalize();
+    fields.residuals() = norms;
+    std::sort(unphysical.begin(), unphysical.end());
+
     /// Update stage counter
     inner_iter = (inner_iter + 1) % input.numerical.time_stages;
 }
 
+/**
+ * @brief Restarts multi-stage integration from the first stage.
+ */
+void reset_stage_counter() {
+    inner_iter = 0;
+}
+
+/**
+ * @brief Applies a solution increment computed by an implicit scheme.
+ *
+ * Adds `dW` (five entries per cell, cell by cell) to the conservative
+ * variables, refreshes the primitive cache, accumulates the residual
+ * norms of `fields.b` and collects the unphysical cells, as
+ * `advance_solution` does for the explicit scheme.
+ *
+ * @param sim Reference to the Simulation object.
+ * @param dW Solution increment.
+ */
+void apply_increment(Simulation& sim, const std::vector<double>& dW) {
+    auto& fields = sim.fields;
+    const int n_elements = sim.mesh.n_elements;
+    constexpr int n_var = 5;
+
+    std::vector<int>& unphysical = fields.unphysical_cells();
+    unphysical.clear();
+
+    Residuals norms = blocked_reduce(
+        n_elements, Residuals{},
+        [&](int i, Residuals& acc) {
+            for (int v = 0; v < n_var; ++v) {
+                fields.W(i, v) += dW[i * n_var + v];
+                acc.add(v, fields.b(i, v));
+            }
+            fields.update_primitives(i);
+            if (!fields.is_physical(i)) {
+                #pragma omp critical
+                unphysical.push_back(i);
+            }
+        },
+        [](Residuals& a, const Residuals& b) { a.merge(b); }
+    );
+    norms.finalize();
+    fields.residuals() = norms;
+    std::sort(unphysical.begin(), unphysical.end());
+}
+
+/**
+ * @brief Gathers the right-hand side `S - sum(sign F)` of all cells.
+ *
+ * @param sim Reference to the Simulation object.
+ * @param b Output vector, five entries per cell.
+ */
+void gather_rhs(const Simulation& sim, std::vector<double>& b) {
+    const auto& csr = sim.mesh.csr;
+    const auto& fields = sim.fields;
+    constexpr int n_var = 5;
+
+    #pragma omp parallel for
+    for (int i = 0; i < sim.mesh.n_elements; ++i) {
+        double r[n_var];
+        for (int v = 0; v < n_var; ++v) {
+            r[v] = fields.S(i, v);
+        }
+        for (int s = csr.begin(i); s < csr.end(i); ++s) {
+            const double sign = csr.sign[s];
+            const int u = csr.unique[s];
+            for (int v = 0; v < n_var; ++v) {
+                r[v] -= sign * fields.F(u, v);
+            }
+        }
+        for (int v = 0; v < n_var; ++v) {
+            b[i * n_var + v] = std::isnan(r[v]) ? 0.0 : r[v];
+        }
+    }
+}
+
 } // namespace eulercpp::math
@@ -27,7 +27,9 @@
  * calculations. For each element, vectors from centroids to faces
  * (`df`) and to neighbors (`d`) are computed. These vectors are used
  * to construct reconstruction weights and the inverse reconstruction
- * matrix `S`.
+ * matrix `S`, which are combined into per-face least-squares gradient
+ * coefficients. Green-Gauss gradients only need the unique face area
+ * vectors and the element volumes, which are stored instead.
  *
  * @author Alessio Improta
  */
@@ -47,57 +49,97 @@ namespace eulercpp {
  * For each element, this function calculates:
  * - **df**: Vector from element centroid to face centroid.
  * - **d** : Vector from element centroid to neighbor centroid.
- * - **w** : Reconstruction weights based on normalized `d` vectors.
- * - **S** : Inverse of the reconstruction matrix used in gradient
- *           evaluation.
+ * - **c** : Least-squares gradient coefficients `c_f = S * w_f`, where
+ *           `w_f = d / |d|^2` and `S` is the inverse of the
+ *           reconstruction matrix. The gradient of a cell is
+ *           `sum_f c_f * (W_neighbor - W_cell)`.
  *
- * The computation adapts to the specified dimension:
+ * The least-squares matrix adapts to the specified dimension:
  * - **3D**: Full 3x3 reconstruction matrix.
  * - **2D**: 2x2 reconstruction matrix embedded in 3x3.
  * - **1D**: Single scalar reconstruction weight.
  *
+ * For Green-Gauss gradients, d and c are left empty. The area vector
+ * `A_f * n_f` of each unique face and `1 / (2 V)` of each element are
+ * stored instead, and the gradient of a cell is
+ * `sum_f sign_f * A_f * n_f * (W_neighbor - W_cell) / (2 V)`. Since
+ * `sum_f A_f n_f = 0` on a closed cell, this equals the surface integral
+ * of the face averages `(W_cell + W_neighbor) / 2`, with boundary faces
+ * taking the cell value.
+ *
+ * Components beyond the dimension are zero. Face normals and element
+ * volumes must be computed, and not yet scaled for axisymmetry.
+ *
  * @param mesh Reference to the mesh containing elements and faces.
  * @param dimension Input dimension cods as defined in load_physics.hpp.
+ * @param gradient Gradient method the coefficients are built for.
  */
-void compute_distances(Mesh& mesh, const int dimension) {
+void compute_distances(Mesh& mesh, const int dimension,
+                       const math::Gradient gradient) {
     const int dim_ = dimension == 3 ? 3 : dimension == 0 ? 1 : 2;
 
     Logger::debug() << "Computing distances for each element...";
+    Connectivity& csr = mesh.csr;
+    csr.df.assign(mesh.n_faces, {0.0, 0.0, 0.0});
+    const bool green_gauss = gradient == math::Gradient::GREEN_GAUSS;
+
+    if (green_gauss) {
+        csr.d.clear();
+        csr.c.clear();
+        csr.area.assign(mesh.n_unique_faces, {0.0, 0.0, 0.0});
+        csr.half_inv_volume.resize(mesh.n_elements);
+
+        #pragma omp parallel for
+        for (int u = 0; u < mesh.n_unique_faces; ++u) {
+            const Face& face = mesh.faces[mesh.unique_faces[u].left];
+            for (int dim = 0; dim < dim_; ++dim) {
+                csr.area[u][dim] = face.area * face.normal[dim];
+            }
+        }
+    } else {
+        csr.d.assign(mesh.n_faces, {0.0, 0.0, 0.0});
+        csr.c.assign(mesh.n_faces, {0.0, 0.0, 0.0});
+        csr.area.clear();
+        csr.half_inv_volume.clear();
+    }
+
     #pragma omp parallel for
     for (int i = 0; i < mesh.n_elements; ++i) {
-        Element& elem = mesh.elements[i];
-        int nf = elem.n_faces;
-
-        elem.d.resize(nf);
-        elem.df.resize(nf);
-        elem.w.resize(nf);
-
-        std::array<std::array<double, 3>, 3> S = {0.0};
-        for (int f = 0; f < nf; ++f) {
-            int fi = elem.faces[f];
-            auto& face = mesh.faces[fi];
+        const Element& elem = mesh.elements[i];
 
+        for (int s = csr.begin(i); s < csr.end(i); ++s) {
             for (int dim = 0; dim < 3; ++dim) {
-                elem.df[f][dim] = face.centroid[dim] - elem.centroid[dim];
+                csr.df[s][dim] = mesh.faces[s].centroid[dim]
+                                 - elem.centroid[dim];
             }
+        }
+
+        if (green_gauss) {
+            csr.half_inv_volume[i] = 0.5 / elem.volume;
+            continue;
+        }
 
-            int j = elem.neighbors[f];
+        /// Weights w = d/|d|^2 are stored in c until S is known
+        std::array<std::array<double, 3>, 3> S = {0.0};
+        for (int s = csr.begin(i); s < csr.end(i); ++s) {
+            int j = csr.neighbors[s];
             if (j < 0) continue;
 
             for (int dim = 0; dim < 3; ++dim) {
-                elem.d[f][dim] = mesh.elements[j].centroid[dim]
-                                 - elem.centroid[dim];
+                csr.d[s][dim] = mesh.elements[j].centroid[dim]
+                                - elem.centroid[dim];
             }
 
-            double w = 1.0 / math::dot_product(elem.d[f], elem.d[f]);
+            double w = 1.0 / math::dot_product(csr.d[s], csr.d[s]);
             for (int dim = 0; dim < 3; ++dim) {
-                elem.w[f][dim] = w * elem.d[f][dim];
+                csr.c[s][dim] = w * csr.d[s][dim];
                 for (int dim_j = 0; dim_j < 3; ++dim_j) {
-                    S[dim][dim_j] += elem.w[f][dim] * elem.d[f][dim_j];
+                    S[dim][dim_j] += csr.c[s][dim] * csr.d[s][dim_j];
                 }
             }
         }
 
+        std::array<std::array<double, 3>, 3> Sinv = {0.0};
         double det;
         if (dim_ == 3) {
             det = S[0][0] * (S[1][1] * S[2][2] - S[1][2] * S[2][1]) +
@@ -105,36 +147,43 @@ void compute_distances(Mesh& mesh, const int dimension) {
                   S[0][2] * (S[1][0] * S[2][1] - S[1][1] * S[2][0]);
             double invdet = 1.0 / det;
 
-            elem.S[0][0] =  (S[1][1] * S[2][2] - S[1][2] * S[2][1]) * invdet;
-            elem.S[0][1] = -(S[0][1] * S[2][2] - S[0][2] * S[2][1]) * invdet;
-            elem.S[0][2] =  (S[0][1] * S[1][2] - S[0][2] * S[1][1]) * invdet;
+            Sinv[0][0] =  (S[1][1] * S[2][2] - S[1][2] * S[2][1]) * invdet;
+            Sinv[0][1] = -(S[0][1] * S[2][2] - S[0][2] * S[2][1]) * invdet;
+            Sinv[0][2] =  (S[0][1] * S[1][2] - S[0][2] * S[1][1]) * invdet;
 
-            elem.S[1][0] = -(S[1][0] * S[2][2] - S[1][2] * S[2][0]) * invdet;
-            elem.S[1][1] =  (S[0][0] * S[2][2] - S[0][2] * S[2][0]) * invdet;
-            elem.S[1][2] = -(S[0][0] * S[1][2] - S[0][2] * S[1][0]) * invdet;
+            Sinv[1][0] = -(S[1][0] * S[2][2] - S[1][2] * S[2][0]) * invdet;
+            Sinv[1][1] =  (S[0][0] * S[2][2] - S[0][2] * S[2][0]) * invdet;
+            Sinv[1][2] = -(S[0][0] * S[1][2] - S[0][2] * S[1][0]) * invdet;
 
-            elem.S[2][0] =  (S[1][0] * S[2][1] - S[1][1] * S[2][0]) * invdet;
-            elem.S[2][1] = -(S[0][0] * S[2][1] - S[0][1] * S[2][0]) * invdet;
-            elem.S[2][2] =  (S[0][0] * S[1][1] - S[0][1] * S[1][0]) * invdet;
+            Sinv[2][0] =  (S[1][0] * S[2][1] - S[1][1] * S[2][0]) * invdet;
+            Sinv[2][1] = -(S[0][0] * S[2][1] - S[0][1] * S[2][0]) * invdet;
+            Sinv[2][2] =  (S[0][0] * S[1][1] - S[0][1] * S[1][0]) * invdet;
 
         } else if (dim_ == 2) {
             det = S[0][0] * S[1][1] - S[0][1] * S[1][0];
             double invdet = 1.0 / det;
 
-            elem.S[0][0] =  S[1][1] * invdet;
-            elem.S[0][1] = -S[0][1] * invdet;
-            elem.S[1][0] = -S[1][0] * invdet;
-            elem.S[1][1] =  S[0][0] * invdet;
-
-            elem.S[2][2] = 1.0;
+            Sinv[0][0] =  S[1][1] * invdet;
+            Sinv[0][1] = -S[0][1] * invdet;
+            Sinv[1][0] = -S[1][0] * invdet;
+            Sinv[1][1] =  S[0][0] * invdet;
         } else {
             det = S[0][0];
             double invdet = 1.0 / det;
 
-            elem.S[0][0] = invdet;
+            Sinv[0][0] = invdet;
+        }
 
-            elem.S[1][1] = 1.0;
-            elem.S[2][2] = 1.0;
+        /// Gradient coefficients c = S^-1 * w
+        for (int s = csr.begin(i); s < csr.end(i); ++s) {
+            const std::array<double, 3> w = csr.c[s];
+            for (int dim = 0; dim < 3; ++dim) {
+                double c = 0.0;
+                for (int dim_j = 0; dim_j < dim_; ++dim_j) {
+                    c += Sinv[dim][dim_j] * w[dim_j];
+                }
+                csr.c[s][dim] = c;
+            }
         }
     }
 }
@@ -34,6 +34,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <omp.h>
 #include <sstream>
 #include <stdexcept>
@@ -43,6 +44,7 @@
 #include <eulercpp/input/input.hpp>
 #include <eulercpp/mesh/mesh.hpp>
 #include <eulercpp/mesh/elements.hpp>
+#include <eulercpp/mesh/parsing.hpp>
 #include <eulercpp/mesh/shapes.hpp>
 #include <eulercpp/math/vectors.hpp>
 #include <eulercpp/output/logger.hpp>
@@ -50,19 +52,131 @@
 namespace eulercpp {
 
 /**
- * @brief Parses an integer from a C-string pointer.
+ * @brief Returns the shape of a fixed-size element type.
  *
- * @param p Pointer to the C-string to parse.
- * @param out Reference to an integer where the parsed value will be stored.
- * @return Pointer to the next character after the parsed integer.
+ * @param type Element type.
+ * @return Number of nodes, number of faces and dimension of the element.
+ * @throws std::runtime_error If the element type has no fixed size
+ *         (polygons and polyhedra) or is not supported.
+ */
+ElementShape element_shape(ElementType type) {
+    switch (type) {
+        case ElementType::POINT:   return {1, 0, 0};
+        case ElementType::LINEAR:  return {2, 2, 1};
+        case ElementType::TRIA:    return {3, 3, 2};
+        case ElementType::QUAD:    return {4, 4, 2};
+        case ElementType::TETRA:   return {4, 4, 3};
+        case ElementType::HEXA:    return {8, 6, 3};
+        case ElementType::PRISM:   return {6, 5, 3};
+        case ElementType::PYRAMID: return {5, 5, 3};
+        default:
+            throw std::runtime_error(
+                "Unsupported element type: "
+                + std::to_string(static_cast<int>(type))
+            );
+    }
+}
+
+/**
+ * @brief Parses an element line of the `$Elements` section.
+ *
+ * The line holds the element id, type, number of tags, the tags and the
+ * node ids. Polygons list their number of nodes before the nodes, and
+ * polyhedra their number of faces followed by the node count and node
+ * ids of each face. Node ids are converted to zero-based indices.
  *
- * @note The function uses `std::strtol` internally and assumes valid input.
+ * @param p Start of the line.
+ * @param end End of the line.
+ * @param elem Element to fill.
+ * @return Position right after the last node id.
+ * @throws std::runtime_error If the line is malformed or the element type
+ *         is not supported.
  */
-inline const char* parse_int(const char* p, int& out) {
-    out = std::strtol(p, const_cast<char**>(&p), 10);
+const char* parse_element(const char* p, const char* end, Element& elem) {
+    int id, type, n_tags;
+    p = parse_field(p, end, id);
+    p = parse_field(p, end, type);
+    p = parse_field(p, end, n_tags);
+
+    std::vector<int> tags;
+    if (n_tags > 0) {
+        tags.resize(n_tags);
+        for (int t = 0; t < n_tags; ++t) {
+            p = parse_field(p, end, tags[t]);
+        }
+    }
+
+    int n_nodes = 0, n_faces = 0, dim = 0;
+    std::vector<int> nodes;
+
+    if (type == static_cast<int>(ElementType::POLYHEDRON)) {
+        dim = 3;
+        p = parse_field(p, end, n_faces);
+        for (int f = 0; f < n_faces; ++f) {
+            int face_nodes;
+            p = parse_field(p, end, face_nodes);
+            n_nodes += face_nodes;
+            nodes.push_back(face_nodes);
+            for (int n = 0; n < face_nodes; ++n) {
+                int node_id;
+                p = parse_field(p, end, node_id);
+                nodes.push_back(node_id - 1);
+            }
+        }
+    } else {
+        if (type == static_cast<int>(ElementType::POLYGON)) {
+            dim = 2;
+            p = parse_field(p, end, n_faces);
+            n_nodes = n_faces;
+        } else {
+            const ElementShape shape =
+                element_shape(static_cast<ElementType>(type));
+            n_nodes = shape.n_nodes;
+            n_faces = shape.n_faces;
+            dim = shape.dimension;
+        }
+
+        nodes.reserve(n_nodes);
+        for (int n = 0; n < n_nodes; ++n) {
+            int node_id;
+            p = parse_field(p, end, node_id);
+            nodes.push_back(node_id - 1);
+        }
+    }
+
+    elem.id = id;
+    elem.dimension = dim;
+    elem.type = static_cast<ElementType>(type);
+    elem.tags = std::move(tags);
+    elem.n_nodes = n_nodes;
+    elem.n_faces = n_faces;
+    elem.nodes = std::move(nodes);
     return p;
 }
 
+/**
+ * @brief Logs the number of elements of each type.
+ *
+ * @param mesh Reference to the Mesh containing the elements.
+ */
+void log_elements(const Mesh& mesh) {
+    int counts[10] = {0};
+    for (const Element& elem : mesh.elements) {
+        counts[static_cast<int>(elem.type)]++;
+    }
+
+    Logger::info() << "Read " << mesh.n_elements << " elements:";
+    const char* names[] = {
+        "POINT", "LINEAR", "TRIA", "QUAD", "TETRA",
+        "HEXA", "PRISM", "PYRAMID", "POLYGON", "POLYHEDRON"
+    };
+    for (int i = 0; i < 10; ++i) {
+        if (counts[i] > 0) {
+            Logger::info() << " - " << names[i] << ": " << counts[i];
+        }
+    }
+}
+
 /**
  * @brief Reads the element data from a mesh file into the mesh structure.
  *
@@ -87,7 +201,6 @@ void read_elements(std::ifstream& file, Mesh& mesh) {
     const std::unordered_set<int> valid3D{4, 5, 6, 7, 9};
 
     std::string line;
-    int counts[10] = {0};
 
     while (std::getline(file, line)) {
         if (line.rfind("$Elements", 0) == 0) {
@@ -106,97 +219,11 @@ void read_elements(std::ifstream& file, Mesh& mesh) {
                     throw std::runtime_error("Unexpected end of file.");
                 }
 
-                const char* p = line.c_str();
-                int id, type, n_tags;
-                p = parse_int(p, id);
-                p = parse_int(p, type);
-                p = parse_int(p, n_tags);
-
-                std::vector<int> tags;
-                if (n_tags > 0) {
-                    tags.resize(n_tags);
-                    for (int t = 0; t < n_tags; ++t) {
-                        p = parse_int(p, tags[t]);
-                    }
-                }
-
-                int n_nodes = 0, n_faces = 0, dim = 0;
-                std::vector<int> nodes;
-
-                if (type == static_cast<int>(ElementType::POLYHEDRON)) {
-                    dim = 3;
-                    p = parse_int(p, n_faces);
-                    for (int f = 0; f < n_faces; ++f) {
-                        int face_nodes;
-                        p = parse_int(p, face_nodes);
-                        n_nodes += face_nodes;
-                        nodes.push_back(face_nodes);
-                        for (int n = 0; n < face_nodes; ++n) {
-                            int node_id;
-                            p = parse_int(p, node_id);
-                            nodes.push_back(node_id - 1);
-                        }
-                    }
-                } else {
-                    switch (static_cast<ElementType>(type)) {
-                        case ElementType::POINT:
-                            n_nodes = 1; n_faces = 0; dim = 0; break;
-                        case ElementType::LINEAR:
-                            n_nodes = 2; n_faces = 2; dim = 1; break;
-                        case ElementType::TRIA:
-                            n_nodes = 3; n_faces = 3; dim = 2; break;
-                        case ElementType::QUAD:
-                            n_nodes = 4; n_faces = 4; dim = 2; break;
-                        case ElementType::TETRA:
-                            n_nodes = 4; n_faces = 4; dim = 3; break;
-                        case ElementType::HEXA:
-                            n_nodes = 8; n_faces = 6; dim = 3; break;
-                        case ElementType::PRISM:
-                            n_nodes = 6; n_faces = 5; dim = 3; break;
-                        case ElementType::PYRAMID:
-                            n_nodes = 5; n_faces = 5; dim = 3; break;
-                        case ElementType::POLYGON:
-                            dim = 2;
-                            p = parse_int(p, n_faces);
-                            n_nodes = n_faces;
-                            break;
-                        default:
-                            throw std::runtime_error(
-                                "Unsupported element type: "
-                                + std::to_string(type)
-                            );
-                    }
-
-                    nodes.reserve(n_nodes);
-                    for (int n = 0; n < n_nodes; ++n) {
-                        int node_id;
-                        p = parse_int(p, node_id);
-                        nodes.push_back(node_id - 1);
-                    }
-                }
-
-                Element& elem = mesh.elements[i];
-                elem.id = id;
-                elem.dimension = dim;
-                elem.type = static_cast<ElementType>(type);
-                elem.tags = std::move(tags);
-                elem.n_nodes = n_nodes;
-                elem.n_faces = n_faces;
-                elem.nodes = std::move(nodes);
-
-                counts[type]++;
+                parse_element(line.data(), line.data() + line.size(),
+                              mesh.elements[i]);
             }
 
-            Logger::info() << "Read " << mesh.n_elements << " elements:";
-            const char* names[] = {
-                "POINT", "LINEAR", "TRIA", "QUAD", "TETRA",
-                "HEXA", "PRISM", "PYRAMID", "POLYGON", "POLYHEDRON"
-            };
-            for (int i = 0; i < 10; ++i) {
-                if (counts[i] > 0) {
-                    Logger::info() << " - " << names[i] << ": " << counts[i];
-                }
-            }
+            log_elements(mesh);
             return;
         }
     }
@@ -225,99 +252,109 @@ void compute_elements(Mesh& mesh, Input& input) {
     const int dim_ = input.physics.dimension;
     const int dimension = dim_ == 3 ? 3 : dim_ == 0 ? 1 : 2;
 
-    #pragma omp parallel for
-    for (int i = 0; i < mesh.n_elements; ++i) {
-        Element& elem = mesh.elements[i];
-        if (elem.dimension > dimension) {
-            throw std::runtime_error("Invalid element dimension.");
-        }
-        if (elem.dimension < dimension-1) {
-            throw std::runtime_error("Invalid element dimension.");
-        }
-        if (elem.dimension == dimension-1) {
-            if (elem.tags.size() == 0) {
+    #pragma omp parallel
+    {
+        /// Node positions of standard elements live on the stack; polygons
+        /// with more nodes use a scratch vector owned by the thread
+        ShapeBuffer buffer;
+        std::vector<Point3D> scratch;
+
+        #pragma omp for
+        for (int i = 0; i < mesh.n_elements; ++i) {
+            Element& elem = mesh.elements[i];
+            if (elem.dimension > dimension) {
                 throw std::runtime_error("Invalid element dimension.");
             }
-            elem.boundary = true;
-            elem.n_faces = 0;
-            continue;
-        }
+            if (elem.dimension < dimension-1) {
+                throw std::runtime_error("Invalid element dimension.");
+            }
+            if (elem.dimension == dimension-1) {
+                if (elem.tags.size() == 0) {
+                    throw std::runtime_error("Invalid element dimension.");
+                }
+                elem.boundary = true;
+                elem.n_faces = 0;
+                continue;
+            }
 
-        std::vector<std::array<double, 3>> n(elem.n_nodes);
-        for (int j = 0; j < elem.n_nodes; ++j) {
-            n[j] = mesh.nodes[elem.nodes[j]].position;
-        }
+            /// Polyhedra read their nodes in place
+            const int n_nodes =
+                elem.type == ElementType::POLYHEDRON ? 0 : elem.n_nodes;
+            const Point3D* n = gather_positions(
+                mesh, elem.nodes.data(), n_nodes, buffer, scratch
+            );
 
-        switch (elem.type) {
-        case ElementType::POINT:
-            elem.centroid = n[0];
-            elem.volume = 1.0;
-            break;
-
-        case ElementType::LINEAR:
-            elem.centroid = math::mid_point(n[0], n[1]);
-            elem.volume = math::distance(n[0], n[1]);
-            break;
-
-        case ElementType::TRIA:
-            elem.centroid = tria_centroid(n[0], n[1], n[2]);
-            elem.volume = math::norm(tria_vector(n[0], n[1], n[2]));
-            break;
-
-        case ElementType::QUAD:
-        case ElementType::POLYGON:
-        {
-            auto [centroid, area, l] = polygon_properties(n);
-            elem.centroid = centroid;
-            elem.volume = area;
-            break;
-        }
+            switch (elem.type) {
+            case ElementType::POINT:
+                elem.centroid = n[0];
+                elem.volume = 1.0;
+                break;
+
+            case ElementType::LINEAR:
+                elem.centroid = math::mid_point(n[0], n[1]);
+                elem.volume = math::distance(n[0], n[1]);
+                break;
+
+            case ElementType::TRIA:
+                elem.centroid = tria_centroid(n[0], n[1], n[2]);
+                elem.volume = math::norm(tria_vector(n[0], n[1], n[2]));
+                break;
+
+            case ElementType::QUAD:
+            case ElementType::POLYGON:
+            {
+                auto [centroid, area, l] = polygon_properties(n, elem.n_nodes);
+                elem.centroid = centroid;
+                elem.volume = area;
+                break;
+            }
 
-        case ElementType::TETRA:
-            elem.centroid = tetra_centroid(n[0], n[1], n[2], n[3]);
-            elem.volume = tetra_volume(n[0], n[1], n[2], n[3]);
-            break;
-
-        case ElementType::HEXA:
-        {
-            auto [centroid, volume, l] = hexa_properties(n);
-            elem.centroid = centroid;
-            elem.volume = volume;
-            break;
-        }
+            case ElementType::TETRA:
+                elem.centroid = tetra_centroid(n[0], n[1], n[2], n[3]);
+                elem.volume = tetra_volume(n[0], n[1], n[2], n[3]);
+                break;
+
+            case ElementType::HEXA:
+            {
+                auto [centroid, volume, l] = hexa_properties(n);
+                elem.centroid = centroid;
+                elem.volume = volume;
+                break;
+            }
 
-        case ElementType::PRISM:
-        {
-            auto [centroid, volume, l] = prism_properties(n);
-            elem.centroid = centroid;
-            elem.volume = volume;
-            break;
-        }
+            case ElementType::PRISM:
+            {
+                auto [centroid, volume, l] = prism_properties(n);
+                elem.centroid = centroid;
+                elem.volume = volume;
+                break;
+            }
 
-        case ElementType::PYRAMID:
-        {
-            auto [centroid, volume, l] = pyramid_properties(n);
-            elem.centroid = centroid;
-            elem.volume = volume;
-            break;
-        }
+            case ElementType::PYRAMID:
+            {
+                auto [centroid, volume, l] = pyramid_properties(n);
+                elem.centroid = centroid;
+                elem.volume = volume;
+                break;
+            }
 
-        case ElementType::POLYHEDRON:
-        {
-            auto [centroid, volume, l] = polyhedron_properties(
-                elem.n_faces, elem.nodes, mesh
-            );
-            elem.centroid = centroid;
-            elem.volume = volume;
-            break;
-        }
+            case ElementType::POLYHEDRON:
+            {
+                auto [centroid, volume, l] = polyhedron_properties(
+                    elem.n_faces, elem.nodes, mesh
+                );
+                elem.centroid = centroid;
+                elem.volume = volume;
+                break;
+            }
+            }
+            volumes[i] = elem.volume;
         }
-        volumes[i] = elem.volume;
     }
 
-    double min_volume = volumes[0];
-    double max_volume = volumes[0];
-    for (size_t i = 1; i < volumes.size(); ++i) {
+    double min_volume = std::numeric_limits<double>::max();
+    double max_volume = 0.0;
+    for (size_t i = 0; i < volumes.size(); ++i) {
         if (mesh.elements[i].boundary) continue;
         if (volumes[i] < min_volume) min_volume = volumes[i];
         if (volumes[i] > max_volume) max_volume = volumes[i];
@@ -331,4 +368,33 @@ void compute_elements(Mesh& mesh, Input& input) {
     }
 }
 
+/**
+ * @brief Removes boundary elements from the mesh.
+ *
+ * Boundary elements only carry boundary tags and are not part of the
+ * computational domain. They are moved out of the mesh before faces are
+ * built, so that element indices stay valid in the face connectivity.
+ *
+ * @param mesh Reference to the Mesh containing the elements.
+ * @return The boundary elements, in file order.
+ */
+std::vector<Element> extract_boundary_elements(Mesh& mesh) {
+    std::vector<Element> boundary_elements;
+    std::vector<Element> elements;
+    elements.reserve(mesh.n_elements);
+
+    for (auto& elem : mesh.elements) {
+        if (elem.boundary) {
+            boundary_elements.push_back(std::move(elem));
+        } else {
+            elements.push_back(std::move(elem));
+        }
+    }
+
+    mesh.elements = std::move(elements);
+    mesh.n_elements = mesh.elements.size();
+
+    return boundary_elements;
+}
+
 } // namespace eulercpp
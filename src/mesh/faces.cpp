@@ -32,7 +32,6 @@
 
 #include <iostream>
 #include <omp.h>
-#include <unordered_map>
 #include <vector>
 #include <algorithm>
 
@@ -71,65 +70,213 @@ static const int pyramid_index[16] = {
 };
 
 /**
- * @brief Helper struct for hashing face node vectors in a map.
+ * @brief Lexicographic order of face keys by node set.
+ */
+static bool key_less(const FaceKey& a, const FaceKey& b) {
+    if (a.nodes != b.nodes) return a.nodes < b.nodes;
+    return a.n_nodes < b.n_nodes;
+}
+
+/**
+ * @brief Checks whether two face keys have the same node set prefix.
+ */
+static bool key_equal(const FaceKey& a, const FaceKey& b) {
+    return a.nodes == b.nodes && a.n_nodes == b.n_nodes;
+}
+
+/**
+ * @brief Checks whether two faces with equal keys share all their nodes.
  *
- * Used to identify unique faces by their nodes, regardless of node
- * ordering.
+ * Keys hold the four smallest nodes, so only faces with more nodes need
+ * the full comparison.
  */
-struct FaceKeyHash {
-    std::size_t operator()(const std::vector<int>& key) const {
-        std::size_t h = 0;
-        for (int node : key) {
-            h ^= std::hash<int>()(node) + 0x9e3779b9 + (h << 6) + (h >> 2);
+static bool same_nodes(const int* a, const int* b, int n_nodes) {
+    return n_nodes <= 4 || std::is_permutation(a, a + n_nodes, b);
+}
+
+FaceKey make_face_key(const int* nodes, int n_nodes, int face) {
+    FaceKey key;
+    key.nodes = {-1, -1, -1, -1};
+    key.n_nodes = n_nodes;
+    key.face = face;
+
+    /// Insertion into the sorted prefix of the (up to) four smallest nodes
+    int size = 0;
+    for (int k = 0; k < n_nodes; ++k) {
+        const int node = nodes[k];
+        int j = std::min(size, 3);
+        if (size == 4 && node >= key.nodes[3]) continue;
+        while (j > 0 && key.nodes[j - 1] > node) {
+            key.nodes[j] = key.nodes[j - 1];
+            --j;
         }
-        return h;
+        key.nodes[j] = node;
+        size = std::min(size + 1, 4);
     }
-};
+    return key;
+}
+
+FaceTable build_face_table(const Mesh& mesh) {
+    FaceTable table;
+    const int n_buckets = mesh.n_nodes;
+
+    /// Count the faces whose smallest node is each mesh node
+    std::vector<int>& offsets = table.offsets;
+    offsets.assign(n_buckets + 1, 0);
+    #pragma omp parallel for
+    for (int f = 0; f < mesh.n_faces; ++f) {
+        const Face& face = mesh.faces[f];
+        if (face.n_nodes <= 0) continue;
+        const int b = *std::min_element(face.nodes.begin(), face.nodes.end());
+        #pragma omp atomic
+        offsets[b + 1]++;
+    }
+    for (int b = 0; b < n_buckets; ++b) {
+        offsets[b + 1] += offsets[b];
+    }
+
+    /// Scatter the keys into their buckets
+    table.keys.resize(offsets[n_buckets]);
+    std::vector<int> next(offsets.begin(), offsets.end() - 1);
+    #pragma omp parallel for
+    for (int f = 0; f < mesh.n_faces; ++f) {
+        const Face& face = mesh.faces[f];
+        if (face.n_nodes <= 0) continue;
+        const FaceKey key = make_face_key(face.nodes.data(), face.n_nodes, f);
+        int k;
+        #pragma omp atomic capture
+        k = next[key.nodes[0]]++;
+        table.keys[k] = key;
+    }
+
+    /// Sort every bucket by node set, then by face index
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for (int b = 0; b < n_buckets; ++b) {
+        std::sort(table.keys.begin() + offsets[b],
+                  table.keys.begin() + offsets[b + 1],
+                  [](const FaceKey& x, const FaceKey& y) {
+                      if (key_less(x, y)) return true;
+                      if (key_less(y, x)) return false;
+                      return x.face < y.face;
+                  });
+    }
+
+    return table;
+}
+
+int FaceTable::find(const int* nodes, int n_nodes, const Mesh& mesh) const {
+    if (n_nodes <= 0) return -1;
+    const FaceKey key = make_face_key(nodes, n_nodes, -1);
+    const int b = key.nodes[0];
+    if (b < 0 || b + 1 >= static_cast<int>(offsets.size())) return -1;
+
+    auto it = std::lower_bound(keys.begin() + offsets[b],
+                               keys.begin() + offsets[b + 1],
+                               key, key_less);
+    int found = -1;
+    for (; it != keys.begin() + offsets[b + 1] && key_equal(*it, key); ++it) {
+        if (same_nodes(nodes, mesh.faces[it->face].nodes.data(), n_nodes)) {
+            found = it->face;
+        }
+    }
+    return found;
+}
 
 /**
  * @brief Computes neighbor and opposite face relationships for all faces.
  *
- * Iterates through all faces, identifying shared faces between elements
- * and setting neighbor and opposite indices. Also updates element neighbor
- * lists.
+ * Half-faces sharing a node set are adjacent in the face table and sorted
+ * by face index; they are paired in face order, first with second, third
+ * with fourth. Buckets are independent and matched in parallel. Unique
+ * faces and the element neighbor lists are then built.
  *
  * @param mesh Reference to the Mesh structure.
+ * @param table Face table of the mesh.
  */
-void compute_face_connectivity(Mesh& mesh) {
-    std::unordered_map<std::vector<int>, int, FaceKeyHash> face_map;
-
-    for (int i = 0; i < mesh.n_faces; ++i) {
-        Face& face = mesh.faces[i];
+static void compute_face_connectivity(Mesh& mesh, const FaceTable& table) {
+    const int n_buckets = static_cast<int>(table.offsets.size()) - 1;
+
+    #pragma omp parallel for schedule(dynamic, 1024)
+    for (int b = 0; b < n_buckets; ++b) {
+        const int end = table.offsets[b + 1];
+        for (int first = table.offsets[b]; first < end; ) {
+            int last = first + 1;
+            while (last < end &&
+                   key_equal(table.keys[first], table.keys[last])) {
+                ++last;
+            }
 
-        std::vector<int> key = face.nodes;
-        std::sort(key.begin(), key.end());
+            for (int i = first; i < last; ++i) {
+                Face& face = mesh.faces[table.keys[i].face];
+                if (face.opposite != -1) continue;
+                for (int j = i + 1; j < last; ++j) {
+                    Face& other = mesh.faces[table.keys[j].face];
+                    if (other.opposite != -1 ||
+                        !same_nodes(face.nodes.data(), other.nodes.data(),
+                                    face.n_nodes)) continue;
 
-        auto it = face_map.find(key);
-        if (it == face_map.end()) {
-            face_map[key] = i;
-        } else {
-            int other_index = it->second;
-            Face& other = mesh.faces[other_index];
+                    face.neighbor = other.owner;
+                    other.neighbor = face.owner;
 
-            face.neighbor = other.owner;
-            other.neighbor = face.owner;
+                    face.opposite = other.id;
+                    other.opposite = face.id;
+                    break;
+                }
+            }
+            first = last;
+        }
+    }
 
-            face.opposite = other.id;
-            other.opposite = face.id;
+    compute_unique_faces(mesh);
+}
 
-            face_map.erase(it);
+/**
+ * @brief Builds unique faces and the per-slot element connectivity.
+ *
+ * Paired half-faces are grouped into unique faces in face order, so that
+ * the numbering does not depend on how pairs were found. Neighbor, unique
+ * face and sign arrays of the CSR connectivity are filled accordingly.
+ *
+ * @param mesh Reference to the Mesh structure.
+ */
+void compute_unique_faces(Mesh& mesh) {
+    Logger::debug() << "Building unique faces...";
+    mesh.unique_faces.clear();
+    mesh.unique_faces.reserve(mesh.n_faces);
+    for (int i = 0; i < mesh.n_faces; ++i) {
+        Face& face = mesh.faces[i];
+        const int j = face.opposite;
+        if (j != -1 && j < i) continue;
+
+        UniqueFace uface;
+        uface.left = i;
+        uface.right = j;
+        uface.owner = face.owner;
+        uface.neighbor = face.neighbor;
+
+        const int u = mesh.unique_faces.size();
+        face.unique = u;
+        face.sign = 1;
+        if (j != -1) {
+            mesh.faces[j].unique = u;
+            mesh.faces[j].sign = -1;
         }
+        mesh.unique_faces.push_back(uface);
     }
+    mesh.n_unique_faces = mesh.unique_faces.size();
 
     Logger::debug() << "Assigning element neighbors...";
+    Connectivity& csr = mesh.csr;
+    csr.neighbors.resize(mesh.n_faces);
+    csr.unique.resize(mesh.n_faces);
+    csr.sign.resize(mesh.n_faces);
     #pragma omp parallel for
     for (int i = 0; i < mesh.n_elements; ++i) {
-        Element& elm = mesh.elements[i];
-        int n_f = elm.n_faces;
-        elm.neighbors.resize(n_f);
-        for (int f = 0; f < n_f; ++f) {
-            Face& face = mesh.faces[elm.faces[f]];
-            elm.neighbors[f] = face.neighbor;
+        for (int s = csr.begin(i); s < csr.end(i); ++s) {
+            const Face& face = mesh.faces[s];
+            csr.neighbors[s] = face.neighbor;
+            csr.unique[s] = face.unique;
+            csr.sign[s] = face.sign;
         }
     }
 }
@@ -139,176 +286,194 @@ void compute_face_connectivity(Mesh& mesh) {
  *
  * This function calculates face areas, centroids, and element neighbors.
  * It identifies boundary faces and sets up opposite face relationships
- * between neighboring elements.
+ * between neighboring elements. Face ids are assigned from an exclusive
+ * prefix sum over the number of element faces, so the faces of each
+ * element are contiguous, in element order, and independent of the
+ * number of threads. Half-faces are paired through the sorted face table.
  *
  * @param mesh Reference to the Mesh structure containing faces and elements.
+ * @return The sorted face table of the mesh.
  */
-void compute_faces(Mesh& mesh) {
+FaceTable compute_faces(Mesh& mesh) {
     Logger::debug() << "Counting faces...";
-    for (const auto& elem : mesh.elements) {
-        mesh.n_faces += elem.n_faces;
+    Connectivity& csr = mesh.csr;
+    csr.offsets.assign(mesh.n_elements + 1, 0);
+    csr.max_faces = 0;
+    for (int i = 0; i < mesh.n_elements; ++i) {
+        csr.offsets[i + 1] = csr.offsets[i] + mesh.elements[i].n_faces;
+        csr.max_faces = std::max(csr.max_faces, mesh.elements[i].n_faces);
     }
+    mesh.n_faces = csr.offsets[mesh.n_elements];
 
     mesh.faces.resize(mesh.n_faces);
 
     Logger::debug() << "Computing face properties...";
-    int id = 0;
-    #pragma omp parallel for
-    for (int i = 0; i < mesh.n_elements; ++i) {
-        Element& elem = mesh.elements[i];
-        elem.faces.resize(elem.n_faces);
-
-        for (int f = 0; f < elem.n_faces; ++f) {
-            int local_id;
-            #pragma omp atomic capture
-            local_id = id++;
-            elem.faces[f] = local_id;
-            Face& face = mesh.faces[local_id];
-            face.id = local_id;
-            face.owner = i;
-
-            switch (elem.type) {
-                case ElementType::POINT:
-                    break;
-
-                case ElementType::LINEAR:
-                    face.n_nodes = 1;
-                    face.nodes.resize(face.n_nodes);
-                    face.nodes[0] = elem.nodes[f];
-                    face.centroid = mesh.nodes[face.nodes[0]].position;
-                    face.area = 1.0;
-                    break;
-
-                case ElementType::TRIA:
-                case ElementType::QUAD:
-                case ElementType::POLYGON:
-                {
-                    face.n_nodes = 2;
-                    face.nodes.resize(face.n_nodes);
-                    face.nodes[0] = elem.nodes[f];
-                    face.nodes[1] = elem.nodes[(f+1) % elem.n_nodes];
-
-                    math::Vector3D n1 = mesh.nodes[face.nodes[0]].position;
-                    math::Vector3D n2 = mesh.nodes[face.nodes[1]].position;
-
-                    face.centroid = math::mid_point(n1, n2);
-                    face.area = math::distance(n1, n2);
-                    break;
-                }
-
-                case ElementType::TETRA:
-                {
-                    face.n_nodes = 3;
-                    face.nodes.resize(face.n_nodes);
-                    for (int j = 0; j < face.n_nodes; ++j) {
-                        face.nodes[j] = elem.nodes[(f + j) % elem.n_nodes];
-                    }
-
-                    std::vector<math::Vector3D> n(face.n_nodes);
-                    for (int k = 0; k < face.n_nodes; ++k) {
-                        n[k] = mesh.nodes[face.nodes[k]].position;
-                    }
-
-                    face.centroid = tria_centroid(n[0], n[1], n[2]);
-                    face.area = math::norm(tria_vector(n[0], n[1], n[2]));
-                    break;
-                }
+    #pragma omp parallel
+    {
+        /// Node positions of standard faces live on the stack; polyhedron
+        /// faces with more nodes use a scratch vector owned by the thread
+        ShapeBuffer buffer;
+        std::vector<math::Vector3D> scratch;
+
+        #pragma omp for
+        for (int i = 0; i < mesh.n_elements; ++i) {
+            Element& elem = mesh.elements[i];
+
+            for (int f = 0; f < elem.n_faces; ++f) {
+                const int local_id = csr.begin(i) + f;
+                Face& face = mesh.faces[local_id];
+                face.id = local_id;
+                face.owner = i;
+
+                switch (elem.type) {
+                    case ElementType::POINT:
+                        break;
+
+                    case ElementType::LINEAR:
+                        face.n_nodes = 1;
+                        face.nodes.resize(face.n_nodes);
+                        face.nodes[0] = elem.nodes[f];
+                        face.centroid = mesh.nodes[face.nodes[0]].position;
+                        face.area = 1.0;
+                        break;
+
+                    case ElementType::TRIA:
+                    case ElementType::QUAD:
+                    case ElementType::POLYGON:
+                    {
+                        face.n_nodes = 2;
+                        face.nodes.resize(face.n_nodes);
+                        face.nodes[0] = elem.nodes[f];
+                        face.nodes[1] = elem.nodes[(f+1) % elem.n_nodes];
 
-                case ElementType::HEXA:
-                {
-                    face.n_nodes = 4;
-                    face.nodes.resize(face.n_nodes);
-                    for (int j = 0; j < face.n_nodes; ++j) {
-                        face.nodes[j] = elem.nodes[hexa_index[f*4+j]-1];
-                    }
+                        math::Vector3D n1 = mesh.nodes[face.nodes[0]].position;
+                        math::Vector3D n2 = mesh.nodes[face.nodes[1]].position;
 
-                    std::vector<math::Vector3D> n(face.n_nodes);
-                    for (int k = 0; k < face.n_nodes; ++k) {
-                        n[k] = mesh.nodes[face.nodes[k]].position;
+                        face.centroid = math::mid_point(n1, n2);
+                        face.area = math::distance(n1, n2);
+                        break;
                     }
 
-                    auto [centroid, area, l] = polygon_properties(n);
-                    face.centroid = centroid;
-                    face.area = area;
-                    break;
-                }
-
-                case ElementType::PRISM:
-                {
-                    if (f < 3) {
-                        face.n_nodes = 4;
-                        face.nodes.resize(face.n_nodes);
-                        for (int j = 0; j < face.n_nodes; ++j) {
-                            face.nodes[j] =
-                                elem.nodes[prism_index[f*4+j]-1];
-                        }
-                    } else {
+                    case ElementType::TETRA:
+                    {
                         face.n_nodes = 3;
                         face.nodes.resize(face.n_nodes);
                         for (int j = 0; j < face.n_nodes; ++j) {
-                            face.nodes[j] =
-                                elem.nodes[prism_index[12+3*(f-3)+j]-1];
+                            face.nodes[j] = elem.nodes[(f + j) % elem.n_nodes];
                         }
-                    }
 
-                    std::vector<math::Vector3D> n(face.n_nodes);
-                    for (int k = 0; k < face.n_nodes; ++k) {
-                        n[k] = mesh.nodes[face.nodes[k]].position;
-                    }
+                        const math::Vector3D* n = gather_positions(
+                            mesh, face.nodes.data(), face.n_nodes,
+                            buffer, scratch
+                        );
 
-                    auto [centroid, area, l] = polygon_properties(n);
-                    face.centroid = centroid;
-                    face.area = area;
-                    break;
-                }
+                        face.centroid = tria_centroid(n[0], n[1], n[2]);
+                        face.area = math::norm(tria_vector(n[0], n[1], n[2]));
+                        break;
+                    }
 
-                case ElementType::PYRAMID:
-                {
-                    if (f < 1) {
+                    case ElementType::HEXA:
+                    {
                         face.n_nodes = 4;
                         face.nodes.resize(face.n_nodes);
                         for (int j = 0; j < face.n_nodes; ++j) {
-                            face.nodes[j] = elem.nodes[pyramid_index[j]-1];
+                            face.nodes[j] = elem.nodes[hexa_index[f*4+j]-1];
                         }
-                    } else {
-                        face.n_nodes = 3;
-                        face.nodes.resize(face.n_nodes);
-                        for (int j = 0; j < face.n_nodes; ++j) {
-                            face.nodes[j] =
-                                elem.nodes[pyramid_index[4+3*(f-1)+j]-1];
-                        }
-                    }
 
-                    std::vector<math::Vector3D> n(face.n_nodes);
-                    for (int k = 0; k < face.n_nodes; ++k) {
-                        n[k] = mesh.nodes[face.nodes[k]].position;
+                        const math::Vector3D* n = gather_positions(
+                            mesh, face.nodes.data(), face.n_nodes,
+                            buffer, scratch
+                        );
+
+                        auto [centroid, area, l] =
+                            polygon_properties(n, face.n_nodes);
+                        face.centroid = centroid;
+                        face.area = area;
+                        break;
                     }
 
-                    auto [centroid, area, l] = polygon_properties(n);
-                    face.centroid = centroid;
-                    face.area = area;
-                    break;
-                }
+                    case ElementType::PRISM:
+                    {
+                        if (f < 3) {
+                            face.n_nodes = 4;
+                            face.nodes.resize(face.n_nodes);
+                            for (int j = 0; j < face.n_nodes; ++j) {
+                                face.nodes[j] =
+                                    elem.nodes[prism_index[f*4+j]-1];
+                            }
+                        } else {
+                            face.n_nodes = 3;
+                            face.nodes.resize(face.n_nodes);
+                            for (int j = 0; j < face.n_nodes; ++j) {
+                                face.nodes[j] =
+                                    elem.nodes[prism_index[12+3*(f-3)+j]-1];
+                            }
+                        }
+
+                        const math::Vector3D* n = gather_positions(
+                            mesh, face.nodes.data(), face.n_nodes,
+                            buffer, scratch
+                        );
+
+                        auto [centroid, area, l] =
+                            polygon_properties(n, face.n_nodes);
+                        face.centroid = centroid;
+                        face.area = area;
+                        break;
+                    }
 
-                case ElementType::POLYHEDRON:
-                {
-                    int offset = 0;
-                    for (int ff = 0; ff < f; ++ff)
-                        offset += elem.nodes[offset] + 1;
+                    case ElementType::PYRAMID:
+                    {
+                        if (f < 1) {
+                            face.n_nodes = 4;
+                            face.nodes.resize(face.n_nodes);
+                            for (int j = 0; j < face.n_nodes; ++j) {
+                                face.nodes[j] = elem.nodes[pyramid_index[j]-1];
+                            }
+                        } else {
+                            face.n_nodes = 3;
+                            face.nodes.resize(face.n_nodes);
+                            for (int j = 0; j < face.n_nodes; ++j) {
+                                face.nodes[j] =
+                                    elem.nodes[pyramid_index[4+3*(f-1)+j]-1];
+                            }
+                        }
 
-                    face.n_nodes = elem.nodes[offset];
-                    face.nodes.resize(face.n_nodes);
+                        const math::Vector3D* n = gather_positions(
+                            mesh, face.nodes.data(), face.n_nodes,
+                            buffer, scratch
+                        );
 
-                    std::vector<math::Vector3D> n(face.n_nodes);
-                    for (int k = 0; k < face.n_nodes; ++k) {
-                        face.nodes[k] = elem.nodes[offset + 1 + k];
-                        n[k] = mesh.nodes[face.nodes[k]].position;
+                        auto [centroid, area, l] =
+                            polygon_properties(n, face.n_nodes);
+                        face.centroid = centroid;
+                        face.area = area;
+                        break;
                     }
 
-                    auto [centroid, area, _] = polygon_properties(n);
-                    face.centroid = centroid;
-                    face.area = area;
-                    break;
+                    case ElementType::POLYHEDRON:
+                    {
+                        int offset = 0;
+                        for (int ff = 0; ff < f; ++ff)
+                            offset += elem.nodes[offset] + 1;
+
+                        face.n_nodes = elem.nodes[offset];
+                        face.nodes.assign(
+                            elem.nodes.begin() + offset + 1,
+                            elem.nodes.begin() + offset + 1 + face.n_nodes
+                        );
+
+                        const math::Vector3D* n = gather_positions(
+                            mesh, face.nodes.data(), face.n_nodes,
+                            buffer, scratch
+                        );
+
+                        auto [centroid, area, _] =
+                            polygon_properties(n, face.n_nodes);
+                        face.centroid = centroid;
+                        face.area = area;
+                        break;
+                    }
                 }
             }
         }
@@ -316,17 +481,32 @@ void compute_faces(Mesh& mesh) {
 
     Logger::info() << "Loaded " << mesh.n_faces << " faces.";
 
+    Logger::debug() << "Sorting faces...";
+    FaceTable table = build_face_table(mesh);
+
     Logger::debug() << "Computing face connectivity...";
-    compute_face_connectivity(mesh);
+    compute_face_connectivity(mesh, table);
+
+    Logger::info() << "Found " << mesh.n_unique_faces << " unique faces.";
+    return table;
 }
 
 /**
  * @brief Assign boundary conditions.
  *
+ * Boundary regions of the input are applied first, then the tags of the
+ * boundary elements. Boundary elements are looked up in the face table in
+ * parallel and applied in order, so later elements take precedence.
+ *
  * @param mesh Reference to the Mesh structure.
+ * @param boundary_elements Boundary elements carrying the boundary tags.
+ * @param table Face table returned by compute_faces.
  * @param input Reference to the simulation Input structure.
  */
-void assign_boundaries(Mesh& mesh, Input& input) {
+void assign_boundaries(Mesh& mesh,
+                       const std::vector<Element>& boundary_elements,
+                       const FaceTable& table,
+                       Input& input) {
     Logger::debug() << "Counting boundary faces...";
     mesh.n_boundaries = 0;
     for (const auto& face : mesh.faces) {
@@ -339,39 +519,21 @@ void assign_boundaries(Mesh& mesh, Input& input) {
     Logger::debug() << "Assigning boundary conditions...";
     mesh.init_boundaries(input);
 
-    std::unordered_map<std::vector<int>, int, FaceKeyHash> face_map;
-
-    for (int f = 0; f < mesh.n_faces; ++f) {
-        std::vector<int> key = mesh.faces[f].nodes;
-        std::sort(key.begin(), key.end());
-        face_map[key] = f;
+    const int n_elements = boundary_elements.size();
+    std::vector<int> targets(n_elements);
+    #pragma omp parallel for
+    for (int e = 0; e < n_elements; ++e) {
+        const Element& elem = boundary_elements[e];
+        targets[e] = table.find(elem.nodes.data(),
+                                static_cast<int>(elem.nodes.size()), mesh);
     }
 
-    for (int i = 0; i < mesh.n_elements; ++i) {
-        const auto& elem = mesh.elements[i];
-        if (!elem.boundary) continue;
-
-        std::vector<int> key = elem.nodes;
-        std::sort(key.begin(), key.end());
-
-        auto it = face_map.find(key);
-        if (it != face_map.end()) {
-            int f = it->second;
-            if (elem.tags[0] > 0) {
-                mesh.faces[f].flag = elem.tags[0] - 1;
-            }
+    for (int e = 0; e < n_elements; ++e) {
+        const Element& elem = boundary_elements[e];
+        if (targets[e] != -1 && !elem.tags.empty() && elem.tags[0] > 0) {
+            mesh.faces[targets[e]].flag = elem.tags[0] - 1;
         }
     }
-
-    // Erase boundary elements
-    mesh.elements.erase(
-        std::remove_if(mesh.elements.begin(), mesh.elements.end(),
-            [](const Element& s) { return s.boundary; }),
-        mesh.elements.end()
-    );
-
-    // Update number of elements
-    mesh.n_elements = mesh.elements.size();
 }
 
 } // namespace eulercpp
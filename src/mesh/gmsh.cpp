@@ -0,0 +1,716 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file gmsh.cpp
+ * @brief Implementation of the Gmsh mesh readers.
+ *
+ * The format is detected from the `$MeshFormat` header of the mapped file.
+ *
+ * ASCII sections (Gmsh 2.2) are split into chunks of roughly `chunk_bytes`
+ * bytes, moved forward to the next line start. The chunk boundaries depend
+ * only on the file, so the assignment of lines to entries is the same for
+ * any number of threads.
+ *
+ * Binary files (Gmsh 4.1) are walked section by section. Node and element
+ * blocks have a fixed stride, so their entries are copied in parallel
+ * straight from the mapping without any text parsing.
+ *
+ * @author Alessio Improta
+ */
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <eulercpp/mesh/gmsh.hpp>
+#include <eulercpp/mesh/mapped_file.hpp>
+#include <eulercpp/mesh/mesh.hpp>
+#include <eulercpp/mesh/parsing.hpp>
+#include <eulercpp/math/time_utils.hpp>
+#include <eulercpp/output/logger.hpp>
+
+namespace eulercpp {
+
+/** Target size of the chunks parsed by a single thread. */
+constexpr std::size_t chunk_bytes = 1 << 16;
+
+/**
+ * @struct Section
+ * @brief Body of a section of a mesh file.
+ */
+struct Section {
+    const char* begin = nullptr;    /**< First line after the header. */
+    const char* end = nullptr;      /**< Start of the closing tag line. */
+    long long count = 0;            /**< Number of entries in the header. */
+};
+
+/**
+ * @brief Returns the position right after the end of the current line.
+ *
+ * @param p Current position.
+ * @param end End of the buffer.
+ * @return Start of the next line (or end).
+ */
+static const char* next_line(const char* p, const char* end) {
+    const char* eol = static_cast<const char*>(std::memchr(p, '\n', end - p));
+    return eol ? eol + 1 : end;
+}
+
+/**
+ * @brief Finds a section tag standing alone on its line.
+ *
+ * @param text Text to search.
+ * @param tag Tag including the leading `$` (e.g. "$Nodes").
+ * @param from Position where the search starts.
+ * @return Position of the tag, or `npos` if not found.
+ */
+static std::size_t find_tag(std::string_view text, const std::string& tag,
+                            std::size_t from) {
+    std::size_t pos = from;
+    while ((pos = text.find(tag, pos)) != std::string_view::npos) {
+        const std::size_t next = pos + tag.size();
+        const bool line_start = pos == 0 || text[pos - 1] == '\n';
+        const bool line_end = next == text.size() || text[next] == '\n'
+                           || text[next] == '\r';
+        if (line_start && line_end) return pos;
+        pos = next;
+    }
+    return pos;
+}
+
+/**
+ * @brief Locates a section of the mapped file.
+ *
+ * @param file Mapped mesh file.
+ * @param name Section name without the leading `$` (e.g. "Nodes").
+ * @return The section body and its number of entries.
+ * @throws std::runtime_error If the section or its closing tag is missing.
+ */
+static Section find_section(const MappedFile& file, const std::string& name) {
+    const std::string_view text(file.data(), file.size());
+    const std::string open = "$" + name;
+
+    const std::size_t pos = find_tag(text, open, 0);
+    if (pos == std::string_view::npos) {
+        throw std::runtime_error(
+            "No " + open + " section found in mesh file."
+        );
+    }
+
+    Section section;
+    const char* const end = file.data() + file.size();
+    const char* p = next_line(file.data() + pos, end);
+    if (p == end) {
+        throw std::runtime_error("Could not read number of entries of "
+                                 + open + ".");
+    }
+    p = parse_field(p, end, section.count);
+    section.begin = next_line(p, end);
+
+    const std::size_t close = text.find(
+        "\n$End" + name, section.begin - file.data() - 1
+    );
+    if (close == std::string_view::npos) {
+        throw std::runtime_error("Unterminated " + open + " section.");
+    }
+    section.end = file.data() + close + 1;
+    return section;
+}
+
+/**
+ * @brief Splits a section body into line-aligned chunks.
+ *
+ * @param section Section to split.
+ * @return Chunk boundaries (one more than the number of chunks).
+ */
+static std::vector<const char*> split_lines(const Section& section) {
+    const std::size_t bytes = section.end - section.begin;
+    const std::size_t n_chunks = bytes / chunk_bytes + 1;
+
+    std::vector<const char*> bounds(n_chunks + 1);
+    bounds[0] = section.begin;
+    for (std::size_t c = 1; c < n_chunks; ++c) {
+        const char* p = section.begin + c * bytes / n_chunks;
+        if (p < bounds[c - 1]) p = bounds[c - 1];
+        bounds[c] = next_line(p, section.end);
+    }
+    bounds[n_chunks] = section.end;
+    return bounds;
+}
+
+/**
+ * @brief Calls a function on every non-blank line of a chunk.
+ *
+ * @param p Start of the chunk (a line start).
+ * @param end End of the chunk (a line start).
+ * @param f Callable taking the line start and end.
+ */
+template <typename F>
+static void for_each_line(const char* p, const char* end, F&& f) {
+    while (p < end) {
+        const char* eol = static_cast<const char*>(
+            std::memchr(p, '\n', end - p)
+        );
+        if (eol == nullptr) eol = end;
+        if (skip_blanks(p, eol) < eol) f(p, eol);
+        p = eol + 1;
+    }
+}
+
+/**
+ * @brief Parses the entries of a section in parallel.
+ *
+ * Lines of each chunk are counted first; an exclusive prefix sum gives
+ * the index of the first entry of every chunk, then all chunks are parsed
+ * concurrently. Errors are collected and rethrown after the parallel
+ * region.
+ *
+ * @param section Section to parse.
+ * @param name Section name used in error messages.
+ * @param parse Callable taking the line start, line end and entry index.
+ * @throws std::runtime_error If the number of lines does not match the
+ *         section header, or if parsing a line fails.
+ */
+template <typename F>
+static void parse_section(const Section& section, const std::string& name,
+                          F&& parse) {
+    const std::vector<const char*> bounds = split_lines(section);
+    const int n_chunks = static_cast<int>(bounds.size()) - 1;
+
+    std::vector<long long> first(n_chunks + 1, 0);
+    #pragma omp parallel for
+    for (int c = 0; c < n_chunks; ++c) {
+        long long lines = 0;
+        for_each_line(bounds[c], bounds[c + 1],
+                      [&](const char*, const char*) { ++lines; });
+        first[c + 1] = lines;
+    }
+    for (int c = 0; c < n_chunks; ++c) {
+        first[c + 1] += first[c];
+    }
+    if (first[n_chunks] != section.count) {
+        throw std::runtime_error(
+            "Expected " + std::to_string(section.count) + " entries in $"
+            + name + ", found " + std::to_string(first[n_chunks]) + "."
+        );
+    }
+
+    std::string error;
+    #pragma omp parallel for
+    for (int c = 0; c < n_chunks; ++c) {
+        long long index = first[c];
+        try {
+            for_each_line(bounds[c], bounds[c + 1],
+                          [&](const char* line, const char* eol) {
+                              parse(line, eol, index++);
+                          });
+        } catch (const std::exception& e) {
+            #pragma omp critical
+            if (error.empty()) {
+                error = std::string(e.what()) + " ($" + name + " entry "
+                      + std::to_string(index) + ")";
+            }
+        }
+    }
+    if (!error.empty()) {
+        throw std::runtime_error(error);
+    }
+}
+
+/**
+ * @brief Reads nodes and elements of a mapped Gmsh 2.2 ASCII file.
+ *
+ * @param file Mapped mesh file.
+ * @param mesh Mesh whose nodes and elements are filled.
+ */
+static void read_ascii(const MappedFile& file, Mesh& mesh) {
+    /// Nodes
+    Logger::debug() << "Reading nodes...";
+    const Section nodes = find_section(file, "Nodes");
+    if (nodes.count <= 0) {
+        throw std::runtime_error("No nodes found.");
+    }
+    mesh.n_nodes = static_cast<int>(nodes.count);
+    mesh.nodes.resize(mesh.n_nodes);
+    parse_section(nodes, "Nodes",
+                  [&](const char* p, const char* end, long long i) {
+                      parse_node(p, end, mesh.nodes[i]);
+                  });
+    Logger::info() << "Read " << mesh.n_nodes << " nodes.";
+
+    /// Elements
+    Logger::debug() << "Reading elements...";
+    const Section elements = find_section(file, "Elements");
+    if (elements.count <= 0) {
+        throw std::runtime_error("No elements found.");
+    }
+    mesh.n_elements = static_cast<int>(elements.count);
+    mesh.elements.resize(mesh.n_elements);
+    parse_section(elements, "Elements",
+                  [&](const char* p, const char* end, long long i) {
+                      parse_element(p, end, mesh.elements[i]);
+                  });
+    log_elements(mesh);
+}
+
+/**
+ * @struct MeshFormat
+ * @brief Content of the `$MeshFormat` header.
+ */
+struct MeshFormat {
+    double version = 2.2;   /**< Format version. */
+    int file_type = 0;      /**< 0 for ASCII, 1 for binary. */
+    int data_size = 8;      /**< Size of `size_t` in the file. */
+};
+
+/**
+ * @brief Reads the `$MeshFormat` header of a mapped mesh file.
+ *
+ * Files without header are EulerCPP meshes in the Gmsh 2.2 ASCII layout.
+ *
+ * @param file Mapped mesh file.
+ * @param body Set to the position right after the header line.
+ * @return The mesh format.
+ */
+static MeshFormat read_mesh_format(const MappedFile& file, const char*& body) {
+    const std::string_view text(file.data(), file.size());
+    const char* const end = file.data() + file.size();
+
+    MeshFormat format;
+    body = file.data();
+    const std::size_t pos = find_tag(text, "$MeshFormat", 0);
+    if (pos == std::string_view::npos) return format;
+
+    const char* p = next_line(file.data() + pos, end);
+    p = parse_field(p, end, format.version);
+    p = parse_field(p, end, format.file_type);
+    p = parse_field(p, end, format.data_size);
+    body = next_line(p, end);
+    return format;
+}
+
+/**
+ * @struct BinaryCursor
+ * @brief Sequential reader of the binary sections of a mapped file.
+ */
+struct BinaryCursor {
+    const char* p;      /**< Current position. */
+    const char* end;    /**< End of the file. */
+
+    /**
+     * @brief Reserves the next bytes of the file.
+     *
+     * @param bytes Number of bytes.
+     * @return Start of the reserved bytes.
+     * @throws std::runtime_error If the file ends before.
+     */
+    const char* take(std::size_t bytes) {
+        if (static_cast<std::size_t>(end - p) < bytes) {
+            throw std::runtime_error("Unexpected end of mesh file.");
+        }
+        const char* q = p;
+        p += bytes;
+        return q;
+    }
+
+    /** @brief Reads the next value in native byte order. */
+    template <typename T>
+    T read() {
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    /**
+     * @brief Skips the closing tag of a section.
+     *
+     * @param name Section name without the leading `$`.
+     * @throws std::runtime_error If the closing tag does not follow.
+     */
+    void close(const std::string& name) {
+        const std::string tag = "$End" + name;
+        while (p < end && std::isspace(static_cast<unsigned char>(*p))) ++p;
+        if (std::string_view(p, end - p).compare(0, tag.size(), tag) != 0) {
+            throw std::runtime_error("Missing " + tag + " in mesh file.");
+        }
+        p = next_line(p, end);
+    }
+};
+
+/** Physical tag of the entities of each dimension, by entity tag. */
+using EntityTags = std::array<std::unordered_map<int, int>, 4>;
+
+/**
+ * @brief Reads the binary `$Entities` section of a Gmsh 4.1 file.
+ *
+ * Only the first physical tag of every entity is kept; entities without
+ * physical group get the physical tag 0, as in Gmsh 2.2 files.
+ *
+ * @param in Cursor at the start of the section body.
+ * @return Physical tag of every entity.
+ */
+static EntityTags read_entities(BinaryCursor& in) {
+    std::array<std::uint64_t, 4> counts;
+    for (auto& count : counts) count = in.read<std::uint64_t>();
+
+    EntityTags physical;
+    for (int dim = 0; dim < 4; ++dim) {
+        for (std::uint64_t e = 0; e < counts[dim]; ++e) {
+            const int tag = in.read<int>();
+            in.take((dim == 0 ? 3 : 6) * sizeof(double));
+
+            const std::uint64_t n_physical = in.read<std::uint64_t>();
+            int first = 0;
+            for (std::uint64_t k = 0; k < n_physical; ++k) {
+                const int value = in.read<int>();
+                if (k == 0) first = value;
+            }
+            physical[dim][tag] = first;
+
+            if (dim > 0) {
+                const std::uint64_t n_bounding = in.read<std::uint64_t>();
+                in.take(n_bounding * sizeof(int));
+            }
+        }
+    }
+    return physical;
+}
+
+/**
+ * @brief Reads the binary `$Nodes` section of a Gmsh 4.1 file.
+ *
+ * Nodes are stored in file order; the returned table maps node tags to
+ * node indices.
+ *
+ * @param in Cursor at the start of the section body.
+ * @param mesh Mesh whose nodes are filled.
+ * @return Node index of every node tag (-1 for unused tags).
+ */
+static std::vector<int> read_binary_nodes(BinaryCursor& in, Mesh& mesh) {
+    Logger::debug() << "Reading nodes...";
+
+    const std::uint64_t n_blocks = in.read<std::uint64_t>();
+    const std::uint64_t n_nodes = in.read<std::uint64_t>();
+    in.read<std::uint64_t>();
+    const std::uint64_t max_tag = in.read<std::uint64_t>();
+    if (n_nodes == 0) {
+        throw std::runtime_error("No nodes found.");
+    }
+    constexpr std::uint64_t max_int = std::numeric_limits<int>::max();
+    if (n_nodes > max_int || max_tag > max_int) {
+        throw std::runtime_error("Too many nodes in mesh file.");
+    }
+
+    mesh.n_nodes = static_cast<int>(n_nodes);
+    mesh.nodes.resize(mesh.n_nodes);
+    std::vector<int> tag_to_node(max_tag + 1, -1);
+
+    std::uint64_t first = 0;
+    for (std::uint64_t b = 0; b < n_blocks; ++b) {
+        const int dim = in.read<int>();
+        in.read<int>();
+        const int parametric = in.read<int>();
+        const std::uint64_t count = in.read<std::uint64_t>();
+        if (first + count > n_nodes) {
+            throw std::runtime_error("Too many nodes in $Nodes.");
+        }
+
+        const std::size_t stride = (3 + (parametric ? dim : 0))
+                                 * sizeof(double);
+        const char* tags = in.take(count * sizeof(std::uint64_t));
+        const char* coords = in.take(count * stride);
+
+        bool valid = true;
+        #pragma omp parallel for reduction(&&:valid)
+        for (std::int64_t k = 0; k < static_cast<std::int64_t>(count); ++k) {
+            std::uint64_t tag;
+            std::memcpy(&tag, tags + k * sizeof(std::uint64_t), sizeof(tag));
+            valid = valid && tag <= max_tag;
+            if (!valid) continue;
+
+            Node& node = mesh.nodes[first + k];
+            node.id = static_cast<int>(tag);
+            std::memcpy(node.position.data(), coords + k * stride,
+                        3 * sizeof(double));
+            tag_to_node[tag] = static_cast<int>(first + k);
+        }
+        if (!valid) {
+            throw std::runtime_error("Node tag out of range in $Nodes.");
+        }
+        first += count;
+    }
+    if (first != n_nodes) {
+        throw std::runtime_error(
+            "Expected " + std::to_string(n_nodes) + " entries in $Nodes, "
+            "found " + std::to_string(first) + "."
+        );
+    }
+
+    Logger::info() << "Read " << mesh.n_nodes << " nodes.";
+    return tag_to_node;
+}
+
+/**
+ * @brief Converts a Gmsh element type to an EulerCPP element type.
+ *
+ * Gmsh types 1 to 7 (first-order line to pyramid) share their numbering
+ * with ElementType; 15 is the point.
+ *
+ * @param type Gmsh element type.
+ * @return The element type.
+ * @throws std::runtime_error If the element type is not supported.
+ */
+static ElementType gmsh_element_type(int type) {
+    if (type == 15) return ElementType::POINT;
+    if (type >= 1 && type <= 7) return static_cast<ElementType>(type);
+    throw std::runtime_error(
+        "Unsupported Gmsh element type: " + std::to_string(type)
+    );
+}
+
+/**
+ * @brief Reads the binary `$Elements` section of a Gmsh 4.1 file.
+ *
+ * Element tags are set to the physical tag and the tag of the entity of
+ * each block, as in the tags of Gmsh 2.2 files.
+ *
+ * @param in Cursor at the start of the section body.
+ * @param mesh Mesh whose elements are filled.
+ * @param physical Physical tag of every entity.
+ * @param tag_to_node Node index of every node tag.
+ */
+static void read_binary_elements(BinaryCursor& in, Mesh& mesh,
+                                 const EntityTags& physical,
+                                 const std::vector<int>& tag_to_node) {
+    Logger::debug() << "Reading elements...";
+
+    const std::uint64_t n_blocks = in.read<std::uint64_t>();
+    const std::uint64_t n_elements = in.read<std::uint64_t>();
+    in.read<std::uint64_t>();
+    in.read<std::uint64_t>();
+    if (n_elements == 0) {
+        throw std::runtime_error("No elements found.");
+    }
+    if (n_elements > static_cast<std::uint64_t>(
+            std::numeric_limits<int>::max())) {
+        throw std::runtime_error("Too many elements in mesh file.");
+    }
+
+    mesh.n_elements = static_cast<int>(n_elements);
+    mesh.elements.resize(mesh.n_elements);
+
+    std::uint64_t first = 0;
+    for (std::uint64_t b = 0; b < n_blocks; ++b) {
+        const int dim = in.read<int>();
+        const int entity = in.read<int>();
+        const ElementType type = gmsh_element_type(in.read<int>());
+        const std::uint64_t count = in.read<std::uint64_t>();
+        if (first + count > n_elements) {
+            throw std::runtime_error("Too many elements in $Elements.");
+        }
+
+        int tag = 0;
+        if (dim >= 0 && dim < 4) {
+            const auto it = physical[dim].find(entity);
+            if (it != physical[dim].end()) tag = it->second;
+        }
+
+        const ElementShape shape = element_shape(type);
+        const std::size_t stride = (1 + shape.n_nodes)
+                                 * sizeof(std::uint64_t);
+        const char* data = in.take(count * stride);
+
+        bool valid = true;
+        #pragma omp parallel for reduction(&&:valid)
+        for (std::int64_t k = 0; k < static_cast<std::int64_t>(count); ++k) {
+            std::uint64_t ids[9];
+            std::memcpy(ids, data + k * stride, stride);
+
+            Element& elem = mesh.elements[first + k];
+            elem.id = static_cast<int>(ids[0]);
+            elem.dimension = shape.dimension;
+            elem.type = type;
+            elem.tags = {tag, entity};
+            elem.n_nodes = shape.n_nodes;
+            elem.n_faces = shape.n_faces;
+            elem.nodes.resize(shape.n_nodes);
+            for (int n = 0; n < shape.n_nodes; ++n) {
+                const int node = ids[n + 1] < tag_to_node.size()
+                               ? tag_to_node[ids[n + 1]] : -1;
+                valid = valid && node >= 0;
+                elem.nodes[n] = node;
+            }
+        }
+        if (!valid) {
+            throw std::runtime_error("Unknown node tag in $Elements.");
+        }
+        first += count;
+    }
+    if (first != n_elements) {
+        throw std::runtime_error(
+            "Expected " + std::to_string(n_elements) + " entries in "
+            "$Elements, found " + std::to_string(first) + "."
+        );
+    }
+
+    log_elements(mesh);
+}
+
+/**
+ * @brief Reads nodes and elements of a mapped Gmsh 4.1 binary file.
+ *
+ * Sections other than `$Entities`, `$Nodes` and `$Elements` are skipped.
+ *
+ * @param file Mapped mesh file.
+ * @param body Position right after the `$MeshFormat` header line.
+ * @param mesh Mesh whose nodes and elements are filled.
+ */
+static void read_binary(const MappedFile& file, const char* body,
+                        Mesh& mesh) {
+    const std::string_view text(file.data(), file.size());
+    BinaryCursor in{body, file.data() + file.size()};
+
+    if (in.read<int>() != 1) {
+        throw std::runtime_error(
+            "Mesh file was written with a different byte order."
+        );
+    }
+    in.close("MeshFormat");
+
+    EntityTags physical;
+    std::vector<int> tag_to_node;
+    bool has_nodes = false, has_elements = false;
+
+    while (true) {
+        while (in.p < in.end
+               && std::isspace(static_cast<unsigned char>(*in.p))) ++in.p;
+        if (in.p == in.end) break;
+        if (*in.p != '$') {
+            throw std::runtime_error("Malformed section in mesh file.");
+        }
+
+        const char* eol = next_line(in.p, in.end);
+        std::string name(in.p + 1, eol);
+        while (!name.empty() && std::isspace(
+                   static_cast<unsigned char>(name.back()))) {
+            name.pop_back();
+        }
+        in.p = eol;
+
+        if (name == "Entities") {
+            physical = read_entities(in);
+        } else if (name == "Nodes") {
+            tag_to_node = read_binary_nodes(in, mesh);
+            has_nodes = true;
+        } else if (name == "Elements") {
+            if (!has_nodes) {
+                throw std::runtime_error("$Elements found before $Nodes.");
+            }
+            read_binary_elements(in, mesh, physical, tag_to_node);
+            has_elements = true;
+        } else {
+            const std::size_t pos = find_tag(text, "$End" + name,
+                                             in.p - file.data());
+            if (pos == std::string_view::npos) {
+                throw std::runtime_error("Unterminated $" + name
+                                         + " section.");
+            }
+            in.p = file.data() + pos;
+        }
+        in.close(name);
+    }
+
+    if (!has_nodes) {
+        throw std::runtime_error("No $Nodes section found in mesh file.");
+    }
+    if (!has_elements) {
+        throw std::runtime_error("No $Elements section found in mesh file.");
+    }
+}
+
+/**
+ * @brief Reads nodes and elements of a Gmsh mesh file.
+ *
+ * @param filename Path of the mesh file.
+ * @param mesh Mesh whose nodes and elements are filled.
+ * @param reader Reader used for Gmsh 2.2 ASCII files.
+ */
+void read_gmsh(const std::string& filename, Mesh& mesh, MeshReader reader) {
+    const auto start = std::chrono::steady_clock::now();
+
+    const MappedFile file(filename);
+    const char* body = nullptr;
+    const MeshFormat format = read_mesh_format(file, body);
+
+    if (format.version == 4.1 && format.file_type == 1) {
+        if (format.data_size != sizeof(std::uint64_t)) {
+            throw std::runtime_error(
+                "Unsupported data size in mesh file: "
+                + std::to_string(format.data_size)
+            );
+        }
+        Logger::debug() << "Mesh format: Gmsh 4.1 binary";
+        read_binary(file, body, mesh);
+    } else if (format.version >= 2.0 && format.version < 3.0
+               && format.file_type == 0) {
+        Logger::debug() << "Mesh format: Gmsh 2.2 ASCII";
+        if (reader == MeshReader::MAPPED) {
+            read_ascii(file, mesh);
+        } else {
+            std::ifstream stream(filename);
+            if (!stream) {
+                throw std::invalid_argument("Cannot open mesh file "
+                                            + filename);
+            }
+            read_nodes(stream, mesh);
+            read_elements(stream, mesh);
+        }
+    } else {
+        std::ostringstream oss;
+        oss << "Unsupported mesh format " << format.version
+            << (format.file_type ? " binary" : " ASCII")
+            << " (supported: Gmsh 2.2 ASCII, Gmsh 4.1 binary).";
+        throw std::runtime_error(oss.str());
+    }
+
+    const double elapsed = std::max(std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start
+    ).count(), 1.0e-9);
+    const double megabytes = file.size() / 1.0e6;
+    Logger::info() << "Parsed " << std::fixed << std::setprecision(1)
+                   << megabytes << " MB in "
+                   << math::format_duration(elapsed) << " ("
+                   << megabytes / elapsed << " MB/s)";
+}
+
+} // namespace eulercpp
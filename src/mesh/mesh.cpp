@@ -24,6 +24,7 @@
  *
  * This file contains functions to load and process the computational
  * mesh from a file. It includes:
+ * - Loading the preprocessed mesh from its cache, when valid.
  * - Reading nodes and elements from a mesh file.
  * - Computing element and face properties.
  * - Computing face normals and distances.
@@ -41,7 +42,9 @@
 #include <ctime>
 
 #include <eulercpp/input/input.hpp>
+#include <eulercpp/mesh/gmsh.hpp>
 #include <eulercpp/mesh/mesh.hpp>
+#include <eulercpp/mesh/mesh_cache.hpp>
 #include <eulercpp/simulation/simulation.hpp>
 #include <eulercpp/output/logger.hpp>
 #include <eulercpp/math/time_utils.hpp>
@@ -49,12 +52,57 @@
 
 namespace eulercpp {
 
+/**
+ * @brief Reads and preprocesses the mesh file.
+ *
+ * Reads nodes and elements in Gmsh 2.2 ASCII or Gmsh 4.1 binary format,
+ * and sequentially calls the functions that compute element and face
+ * properties, face normals, and distances.
+ *
+ * @param mesh Mesh to fill.
+ * @param input Input settings.
+ */
+static void build_mesh(Mesh& mesh, Input& input) {
+    /// Read nodes and elements
+    read_gmsh(input.mesh.mesh_file, mesh, input.mesh.reader);
+
+    /// Compute elements properties
+    compute_elements(mesh, input);
+
+    /// Separate boundary elements from the computational domain
+    std::vector<Element> boundary_elements = extract_boundary_elements(mesh);
+
+    /// Compute face properties
+    const FaceTable table = compute_faces(mesh);
+
+    /// Assign boundary conditions (before renumbering, while the face
+    /// table is valid; flags move with the faces)
+    assign_boundaries(mesh, boundary_elements, table, input);
+
+    /// Renumber elements and faces
+    renumber_mesh(mesh, input.mesh.renumbering);
+
+    /// Compute face normals
+    compute_normals(mesh);
+
+    /// Compute distances
+    compute_distances(mesh, input.physics.dimension,
+                      input.numerical.gradient);
+
+    /// Gather element volumes for the solver kernels
+    mesh.volumes.resize(mesh.n_elements);
+    for (int i = 0; i < mesh.n_elements; ++i) {
+        mesh.volumes[i] = mesh.elements[i].volume;
+    }
+}
+
 /**
  * @brief Reads and processes the computational mesh from a file.
  *
- * This function opens the specified mesh file and sequentially calls
- * the necessary functions to read nodes, read elements, compute element
- * and face properties, face normals, and distances.
+ * When the mesh cache is enabled, the preprocessed mesh is loaded from
+ * `<mesh_file>.cache` if its key matches the mesh file content and the
+ * preprocessing settings; otherwise the mesh is built from the mesh file
+ * and the cache is (re)written.
  *
  * @param sim The simulation object containing mesh and input information.
  * @throws std::invalid_argument If the mesh file cannot be opened.
@@ -65,38 +113,19 @@ void read_mesh(Simulation& sim) {
     Input& input = sim.input;
     Mesh& mesh = sim.mesh;
 
-    /// Open mesh file
     const std::string filename = input.mesh.mesh_file;
-    Logger::debug() << "Opening mesh file " << filename << "...";
-    std::ifstream file(filename);
-    if (!file) {
-        throw std::invalid_argument("Cannot open mesh file " + filename);
-    }
     Logger::info() << "Reading mesh from " << filename;
 
-    /// Read nodes
-    read_nodes(file, mesh);
-
-    /// Read elements
-    read_elements(file, mesh);
-
-    /// Close mesh file
-    file.close();
-
-    /// Compute elements properties
-    compute_elements(mesh, input);
-
-    /// Compute face properties
-    compute_faces(mesh);
-
-    /// Assign boundary conditions
-    assign_boundaries(mesh, input);
-
-    /// Compute face normals
-    compute_normals(mesh);
-
-    /// Compute distances
-    compute_distances(mesh, input.physics.dimension);
+    if (input.mesh.cache) {
+        const std::string cache_file = filename + ".cache";
+        const std::uint64_t key = mesh_cache_key(filename, input);
+        if (!load_mesh_cache(cache_file, key, mesh)) {
+            build_mesh(mesh, input);
+            save_mesh_cache(cache_file, key, mesh);
+        }
+    } else {
+        build_mesh(mesh, input);
+    }
 
     clock_t end = clock();
     double elapsed = (double)(end - start) / CLOCKS_PER_SEC;
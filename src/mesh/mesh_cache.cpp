@@ -0,0 +1,528 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file mesh_cache.cpp
+ * @brief Implementation of the binary cache of preprocessed meshes.
+ *
+ * A cache file holds a header followed by a sequence of arrays, each
+ * stored as its element count and raw contents padded to 8 bytes.
+ * Elements and faces are stored as fixed-size records, element node and
+ * tag lists as flat arrays with offsets. Data that is only needed by the
+ * preprocessing (face node lists) or cheaply rebuilt on load (face
+ * tangents) is not stored. The header records the layout
+ * version, byte order and record sizes, so that caches written by another
+ * version or build are rebuilt instead of misread.
+ *
+ * @author Alessio Improta
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <eulercpp/input/input.hpp>
+#include <eulercpp/mesh/mapped_file.hpp>
+#include <eulercpp/mesh/mesh.hpp>
+#include <eulercpp/mesh/mesh_cache.hpp>
+#include <eulercpp/mesh/normals.hpp>
+#include <eulercpp/output/logger.hpp>
+
+namespace eulercpp {
+
+/** Version of the cache layout, to be increased whenever it changes. */
+constexpr std::uint32_t cache_version = 4;
+
+/** Size of the blocks of the mesh file hashed independently. */
+constexpr std::size_t hash_block = 1 << 20;
+
+/** Magic bytes at the start of every cache file. */
+constexpr char cache_magic[8] = {'E', 'U', 'L', 'E', 'R', 'M', 'S', 'H'};
+
+/**
+ * @struct ElementRecord
+ * @brief Fixed-size part of an Element.
+ */
+struct ElementRecord {
+    int id;
+    int dimension;
+    int type;
+    int n_nodes;
+    int n_faces;
+    int boundary;
+    double volume;
+    std::array<double, 3> centroid;
+};
+
+/**
+ * @struct FaceRecord
+ * @brief Fixed-size part of a Face.
+ */
+struct FaceRecord {
+    int id;
+    int flag;
+    int owner;
+    int neighbor;
+    int opposite;
+    int unique;
+    int sign;
+    double area;
+    std::array<double, 3> centroid;
+    std::array<double, 3> normal;
+};
+
+/**
+ * @struct CacheHeader
+ * @brief Header of a cache file.
+ */
+struct CacheHeader {
+    char magic[8];                      /**< File signature. */
+    std::uint32_t version;              /**< Layout version. */
+    std::uint32_t byte_order;           /**< 0x01020304 in native order. */
+    std::uint64_t key;                  /**< Cache key. */
+    std::uint32_t record_sizes[4];      /**< Sizes of the stored records. */
+    std::int32_t n_nodes;
+    std::int32_t n_elements;
+    std::int32_t n_faces;
+    std::int32_t n_boundaries;
+    std::int32_t n_unique_faces;
+    std::int32_t max_faces;
+};
+
+static_assert(std::is_trivially_copyable_v<Node>);
+static_assert(std::is_trivially_copyable_v<UniqueFace>);
+
+/**
+ * @brief Fills the header of the current version and build.
+ *
+ * @param key Cache key.
+ * @return Header without mesh sizes.
+ */
+static CacheHeader make_header(std::uint64_t key) {
+    CacheHeader header{};
+    std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+    header.version = cache_version;
+    header.byte_order = 0x01020304;
+    header.key = key;
+    header.record_sizes[0] = sizeof(Node);
+    header.record_sizes[1] = sizeof(ElementRecord);
+    header.record_sizes[2] = sizeof(FaceRecord);
+    header.record_sizes[3] = sizeof(UniqueFace);
+    return header;
+}
+
+/**
+ * @brief Mixes a 64-bit word into a hash.
+ */
+static std::uint64_t mix(std::uint64_t h, std::uint64_t value) {
+    h ^= value;
+    h *= 0x9e3779b97f4a7c15ULL;
+    return h ^ (h >> 32);
+}
+
+/**
+ * @brief Mixes the bit pattern of a double into a hash.
+ */
+static std::uint64_t mix(std::uint64_t h, double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return mix(h, bits);
+}
+
+/**
+ * @brief Hashes a buffer.
+ *
+ * Blocks of `hash_block` bytes are hashed in parallel and their hashes
+ * combined in order, so the result does not depend on the number of
+ * threads.
+ *
+ * @param data Start of the buffer.
+ * @param size Size of the buffer in bytes.
+ * @return The hash.
+ */
+static std::uint64_t hash_bytes(const char* data, std::size_t size) {
+    const std::int64_t n_blocks = (size + hash_block - 1) / hash_block;
+    std::vector<std::uint64_t> hashes(n_blocks);
+
+    #pragma omp parallel for
+    for (std::int64_t b = 0; b < n_blocks; ++b) {
+        const char* p = data + b * hash_block;
+        const std::size_t n = std::min(hash_block, size - b * hash_block);
+
+        std::uint64_t h = 0xcbf29ce484222325ULL;
+        std::size_t k = 0;
+        for (; k + 8 <= n; k += 8) {
+            std::uint64_t word;
+            std::memcpy(&word, p + k, sizeof(word));
+            h = mix(h, word);
+        }
+        std::uint64_t tail = 0;
+        std::memcpy(&tail, p + k, n - k);
+        hashes[b] = mix(h, tail);
+    }
+
+    std::uint64_t h = size;
+    for (const std::uint64_t block : hashes) h = mix(h, block);
+    return h;
+}
+
+/**
+ * @brief Computes the key of the preprocessed mesh of a case.
+ *
+ * @param filename Path of the mesh file.
+ * @param input Input settings.
+ * @return The cache key.
+ */
+std::uint64_t mesh_cache_key(const std::string& filename, const Input& input) {
+    const MappedFile file(filename);
+
+    std::uint64_t key = mix(hash_bytes(file.data(), file.size()),
+                            static_cast<std::uint64_t>(cache_version));
+    key = mix(key, static_cast<std::uint64_t>(input.physics.dimension));
+    key = mix(key, static_cast<std::uint64_t>(input.numerical.gradient));
+    key = mix(key, static_cast<std::uint64_t>(input.mesh.renumbering));
+    key = mix(key, input.mesh.min_volume);
+
+    key = mix(key, static_cast<std::uint64_t>(input.bc.n_boundaries));
+    for (int b = 0; b < input.bc.n_boundaries; ++b) {
+        const auto& bc = input.bc.boundaries[b];
+        for (const double v : {bc.xmin, bc.xmax, bc.ymin, bc.ymax,
+                               bc.zmin, bc.zmax, bc.center[0],
+                               bc.center[1], bc.center[2], bc.radius}) {
+            key = mix(key, v);
+        }
+    }
+    return key;
+}
+
+/**
+ * @brief Writes an array as its size and contents padded to 8 bytes.
+ */
+template <typename T>
+static void write_array(std::ofstream& ofs, const std::vector<T>& data) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const std::uint64_t n = data.size();
+    ofs.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    ofs.write(reinterpret_cast<const char*>(data.data()), n * sizeof(T));
+
+    const char zeros[8] = {0};
+    ofs.write(zeros, (8 - (n * sizeof(T)) % 8) % 8);
+}
+
+/**
+ * @struct CacheReader
+ * @brief Bounds-checked sequential reader of a mapped cache file.
+ */
+struct CacheReader {
+    const char* p;      /**< Current position. */
+    const char* end;    /**< End of the file. */
+
+    /** @brief Copies the next bytes of the file. */
+    void copy(void* out, std::size_t bytes) {
+        if (static_cast<std::size_t>(end - p) < bytes) {
+            throw std::runtime_error("Truncated mesh cache.");
+        }
+        std::memcpy(out, p, bytes);
+        p += bytes;
+    }
+
+    /** @brief Reads an array written by write_array. */
+    template <typename T>
+    void array(std::vector<T>& data) {
+        std::uint64_t n;
+        copy(&n, sizeof(n));
+        if (n > static_cast<std::size_t>(end - p) / sizeof(T)) {
+            throw std::runtime_error("Truncated mesh cache.");
+        }
+        data.resize(n);
+        copy(data.data(), n * sizeof(T));
+        p += std::min<std::size_t>((8 - (n * sizeof(T)) % 8) % 8, end - p);
+    }
+};
+
+/**
+ * @brief Checks flat list offsets read from a cache file.
+ *
+ * @param offsets Offsets of the lists (one more than the lists).
+ * @param n Expected number of lists.
+ * @param size Size of the flat array.
+ * @throws std::runtime_error If the offsets are inconsistent.
+ */
+static void check_offsets(const std::vector<std::int64_t>& offsets,
+                          std::size_t n, std::size_t size) {
+    bool valid = offsets.size() == n + 1 && offsets[0] == 0
+              && offsets[n] == static_cast<std::int64_t>(size);
+    for (std::size_t i = 0; valid && i < n; ++i) {
+        valid = offsets[i] <= offsets[i + 1];
+    }
+    if (!valid) {
+        throw std::runtime_error("Inconsistent mesh cache.");
+    }
+}
+
+/**
+ * @brief Loads a preprocessed mesh from a cache file.
+ *
+ * @param filename Path of the cache file.
+ * @param key Expected cache key.
+ * @param mesh Mesh to fill.
+ * @return True if the mesh was loaded from the cache.
+ */
+bool load_mesh_cache(const std::string& filename, std::uint64_t key,
+                     Mesh& mesh) {
+    if (!std::ifstream(filename)) {
+        Logger::debug() << "No mesh cache found.";
+        return false;
+    }
+
+    try {
+        const MappedFile file(filename);
+        CacheReader in{file.data(), file.data() + file.size()};
+
+        CacheHeader header;
+        in.copy(&header, sizeof(header));
+        const CacheHeader expected = make_header(key);
+        if (std::memcmp(header.magic, expected.magic, sizeof(cache_magic))
+            || header.version != expected.version
+            || header.byte_order != expected.byte_order
+            || std::memcmp(header.record_sizes, expected.record_sizes,
+                           sizeof(header.record_sizes))) {
+            Logger::info() << "Mesh cache written by another version, "
+                           << "rebuilding it.";
+            return false;
+        }
+        if (header.key != key) {
+            Logger::info() << "Mesh cache is out of date, rebuilding it.";
+            return false;
+        }
+
+        Mesh cached;
+        cached.n_nodes = header.n_nodes;
+        cached.n_elements = header.n_elements;
+        cached.n_faces = header.n_faces;
+        cached.n_boundaries = header.n_boundaries;
+        cached.n_unique_faces = header.n_unique_faces;
+        cached.csr.max_faces = header.max_faces;
+
+        std::vector<ElementRecord> element_records;
+        std::vector<std::int64_t> element_node_offsets, element_tag_offsets;
+        std::vector<int> element_nodes, element_tags;
+        std::vector<FaceRecord> face_records;
+
+        in.array(cached.nodes);
+        in.array(element_records);
+        in.array(element_node_offsets);
+        in.array(element_nodes);
+        in.array(element_tag_offsets);
+        in.array(element_tags);
+        in.array(face_records);
+        in.array(cached.unique_faces);
+        in.array(cached.volumes);
+        in.array(cached.file_to_element);
+        in.array(cached.csr.offsets);
+        in.array(cached.csr.neighbors);
+        in.array(cached.csr.unique);
+        in.array(cached.csr.sign);
+        in.array(cached.csr.d);
+        in.array(cached.csr.df);
+        in.array(cached.csr.c);
+        in.array(cached.csr.area);
+        in.array(cached.csr.half_inv_volume);
+
+        const std::size_t n_elements = header.n_elements;
+        const std::size_t n_faces = header.n_faces;
+        if (cached.nodes.size() != static_cast<std::size_t>(header.n_nodes)
+            || element_records.size() != n_elements
+            || face_records.size() != n_faces
+            || cached.unique_faces.size()
+               != static_cast<std::size_t>(header.n_unique_faces)
+            || cached.volumes.size() != n_elements
+            || cached.csr.offsets.size() != n_elements + 1) {
+            throw std::runtime_error("Inconsistent mesh cache.");
+        }
+        check_offsets(element_node_offsets, n_elements, element_nodes.size());
+        check_offsets(element_tag_offsets, n_elements, element_tags.size());
+
+        cached.elements.resize(n_elements);
+        #pragma omp parallel for
+        for (std::int64_t i = 0; i < static_cast<std::int64_t>(n_elements);
+             ++i) {
+            const ElementRecord& r = element_records[i];
+            Element& elem = cached.elements[i];
+            elem.id = r.id;
+            elem.dimension = r.dimension;
+            elem.type = static_cast<ElementType>(r.type);
+            elem.n_nodes = r.n_nodes;
+            elem.n_faces = r.n_faces;
+            elem.boundary = r.boundary != 0;
+            elem.volume = r.volume;
+            elem.centroid = r.centroid;
+            elem.nodes.assign(element_nodes.begin() + element_node_offsets[i],
+                              element_nodes.begin()
+                              + element_node_offsets[i + 1]);
+            elem.tags.assign(element_tags.begin() + element_tag_offsets[i],
+                             element_tags.begin() + element_tag_offsets[i + 1]);
+        }
+
+        cached.faces.resize(n_faces);
+        #pragma omp parallel for
+        for (std::int64_t f = 0; f < static_cast<std::int64_t>(n_faces); ++f) {
+            const FaceRecord& r = face_records[f];
+            Face& face = cached.faces[f];
+            face.id = r.id;
+            face.flag = r.flag;
+            /// Face node lists are not cached
+            face.n_nodes = 0;
+            face.owner = r.owner;
+            face.neighbor = r.neighbor;
+            face.opposite = r.opposite;
+            face.unique = r.unique;
+            face.sign = r.sign;
+            face.area = r.area;
+            face.centroid = r.centroid;
+            face.normal = r.normal;
+        }
+        compute_tangents(cached);
+
+        mesh = std::move(cached);
+    } catch (const std::exception& e) {
+        Logger::warning() << "Cannot read mesh cache " << filename << ": "
+                          << e.what();
+        return false;
+    }
+
+    Logger::info() << "Loaded preprocessed mesh from " << filename << ": "
+                   << mesh.n_elements << " elements, " << mesh.n_faces
+                   << " faces.";
+    return true;
+}
+
+/**
+ * @brief Writes a preprocessed mesh to a cache file.
+ *
+ * @param filename Path of the cache file.
+ * @param key Cache key.
+ * @param mesh Preprocessed mesh.
+ */
+void save_mesh_cache(const std::string& filename, std::uint64_t key,
+                     const Mesh& mesh) {
+    Logger::debug() << "Writing mesh cache...";
+
+    CacheHeader header = make_header(key);
+    header.n_nodes = mesh.n_nodes;
+    header.n_elements = mesh.n_elements;
+    header.n_faces = mesh.n_faces;
+    header.n_boundaries = mesh.n_boundaries;
+    header.n_unique_faces = mesh.n_unique_faces;
+    header.max_faces = mesh.csr.max_faces;
+
+    std::vector<ElementRecord> element_records(mesh.n_elements);
+    std::vector<std::int64_t> element_node_offsets(mesh.n_elements + 1, 0);
+    std::vector<std::int64_t> element_tag_offsets(mesh.n_elements + 1, 0);
+    for (int i = 0; i < mesh.n_elements; ++i) {
+        const Element& elem = mesh.elements[i];
+        element_records[i] = {
+            elem.id, elem.dimension, static_cast<int>(elem.type),
+            elem.n_nodes, elem.n_faces, elem.boundary ? 1 : 0,
+            elem.volume, elem.centroid
+        };
+        element_node_offsets[i + 1] = element_node_offsets[i]
+                                    + elem.nodes.size();
+        element_tag_offsets[i + 1] = element_tag_offsets[i]
+                                   + elem.tags.size();
+    }
+
+    std::vector<int> element_nodes(element_node_offsets.back());
+    std::vector<int> element_tags(element_tag_offsets.back());
+    #pragma omp parallel for
+    for (int i = 0; i < mesh.n_elements; ++i) {
+        const Element& elem = mesh.elements[i];
+        std::copy(elem.nodes.begin(), elem.nodes.end(),
+                  element_nodes.begin() + element_node_offsets[i]);
+        std::copy(elem.tags.begin(), elem.tags.end(),
+                  element_tags.begin() + element_tag_offsets[i]);
+    }
+
+    std::vector<FaceRecord> face_records(mesh.n_faces);
+    #pragma omp parallel for
+    for (int f = 0; f < mesh.n_faces; ++f) {
+        const Face& face = mesh.faces[f];
+        face_records[f] = {
+            face.id, face.flag, face.owner, face.neighbor,
+            face.opposite, face.unique, face.sign, face.area,
+            face.centroid, face.normal
+        };
+    }
+
+    /// Write under a unique temporary name, then rename
+    const std::string tmp = filename + ".tmp" + std::to_string(
+        std::chrono::steady_clock::now().time_since_epoch().count()
+    );
+    {
+        std::ofstream ofs(tmp, std::ios::binary);
+        if (!ofs) {
+            Logger::warning() << "Cannot write mesh cache " << filename;
+            return;
+        }
+
+        ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        write_array(ofs, mesh.nodes);
+        write_array(ofs, element_records);
+        write_array(ofs, element_node_offsets);
+        write_array(ofs, element_nodes);
+        write_array(ofs, element_tag_offsets);
+        write_array(ofs, element_tags);
+        write_array(ofs, face_records);
+        write_array(ofs, mesh.unique_faces);
+        write_array(ofs, mesh.volumes);
+        write_array(ofs, mesh.file_to_element);
+        write_array(ofs, mesh.csr.offsets);
+        write_array(ofs, mesh.csr.neighbors);
+        write_array(ofs, mesh.csr.unique);
+        write_array(ofs, mesh.csr.sign);
+        write_array(ofs, mesh.csr.d);
+        write_array(ofs, mesh.csr.df);
+        write_array(ofs, mesh.csr.c);
+        write_array(ofs, mesh.csr.area);
+        write_array(ofs, mesh.csr.half_inv_volume);
+
+        if (!ofs) {
+            ofs.close();
+            std::remove(tmp.c_str());
+            Logger::warning() << "Cannot write mesh cache " << filename;
+            return;
+        }
+    }
+
+    std::remove(filename.c_str());
+    if (std::rename(tmp.c_str(), filename.c_str()) != 0) {
+        std::remove(tmp.c_str());
+        Logger::warning() << "Cannot write mesh cache " << filename;
+        return;
+    }
+    Logger::info() << "Mesh cache written to " << filename;
+}
+
+} // namespace eulercpp
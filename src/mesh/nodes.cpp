@@ -39,10 +39,28 @@
 
 #include <eulercpp/mesh/mesh.hpp>
 #include <eulercpp/mesh/nodes.hpp>
+#include <eulercpp/mesh/parsing.hpp>
 #include <eulercpp/output/logger.hpp>
 
 namespace eulercpp {
 
+/**
+ * @brief Parses a node line of the `$Nodes` section.
+ *
+ * @param p Start of the line.
+ * @param end End of the line.
+ * @param node Node to fill.
+ * @return Position right after the last coordinate.
+ * @throws std::runtime_error If the line is not `<id> <x> <y> <z>`.
+ */
+const char* parse_node(const char* p, const char* end, Node& node) {
+    p = parse_field(p, end, node.id);
+    for (int d = 0; d < 3; ++d) {
+        p = parse_field(p, end, node.position[d]);
+    }
+    return p;
+}
+
 /**
  * @brief Reads the node data from a mesh file into the mesh structure.
  *
@@ -86,11 +104,8 @@ void read_nodes(std::ifstream& file, Mesh& mesh) {
                     throw std::runtime_error(oss.str());
                 }
 
-                char* ptr = buffer;
-                mesh.nodes[i].id = std::strtol(ptr, &ptr, 10);
-                for (int d = 0; d < 3; ++d) {
-                    mesh.nodes[i].position[d] = std::strtod(ptr, &ptr);
-                }
+                parse_node(buffer, buffer + std::strlen(buffer),
+                           mesh.nodes[i]);
             }
 
             Logger::info() << "Read " << mesh.n_nodes << " nodes.";
@@ -77,6 +77,7 @@ void compute_normals(Mesh& mesh) {
         Element& element = mesh.elements[i];
         math::Vector3D c = element.centroid;
         int nf = element.n_faces;
+        Face* faces = &mesh.faces[mesh.csr.begin(i)];
 
         switch (element.type)
         {
@@ -85,7 +86,7 @@ void compute_normals(Mesh& mesh) {
 
         case ElementType::LINEAR:
             for (int f = 0; f < nf; ++f) {
-                Face& face = mesh.faces[element.faces[f]];
+                Face& face = faces[f];
                 math::Vector3D cf = face.centroid;
                 math::Vector3D n = {cf[0]-c[0], cf[1]-c[1], cf[2]-c[2]};
                 math::normalize(n);
@@ -97,7 +98,7 @@ void compute_normals(Mesh& mesh) {
         case ElementType::QUAD:
         case ElementType::POLYGON:
             for (int f = 0; f < nf; ++f) {
-                Face& face = mesh.faces[element.faces[f]];
+                Face& face = faces[f];
 
                 math::Vector3D t = {
                     mesh.nodes[face.nodes[1]].position[0] -
@@ -132,7 +133,7 @@ void compute_normals(Mesh& mesh) {
         case ElementType::PYRAMID:
         case ElementType::POLYHEDRON:
             for (int f = 0; f < nf; ++f) {
-                Face& face = mesh.faces[element.faces[f]];
+                Face& face = faces[f];
                 int face_nodes = face.n_nodes;
 
                 math::Vector3D H = {0.0, 0.0, 0.0};
@@ -173,6 +174,18 @@ void compute_normals(Mesh& mesh) {
         }
     }
 
+    compute_tangents(mesh);
+}
+
+/**
+ * @brief Computes the tangent vectors `t1` and `t2` of all mesh faces.
+ *
+ * `t1` is obtained by a deterministic projection of the normal, `t2` as
+ * the cross product of the normal and `t1`.
+ *
+ * @param mesh Reference to the mesh with computed face normals.
+ */
+void compute_tangents(Mesh& mesh) {
     Logger::debug() << "Computing face tangents...";
     /// Compute face tangents
     #pragma omp parallel for
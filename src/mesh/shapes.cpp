@@ -74,6 +74,34 @@ static void add_tetra(const Point3D& a,
     total_volume += vol;
 }
 
+/**
+ * @brief Gathers the positions of a list of nodes.
+ *
+ * @param mesh Mesh providing node coordinates.
+ * @param nodes Node indices.
+ * @param n_nodes Number of nodes.
+ * @param buffer Fixed-capacity buffer.
+ * @param scratch Per-thread scratch vector for larger node lists.
+ * @return Pointer to the first gathered position.
+ */
+const Point3D* gather_positions(const Mesh& mesh,
+                                const int* nodes,
+                                int n_nodes,
+                                ShapeBuffer& buffer,
+                                std::vector<Point3D>& scratch) {
+    Point3D* positions = buffer.data();
+    if (n_nodes > max_shape_nodes) {
+        if (static_cast<int>(scratch.size()) < n_nodes) {
+            scratch.resize(n_nodes);
+        }
+        positions = scratch.data();
+    }
+    for (int k = 0; k < n_nodes; ++k) {
+        positions[k] = mesh.nodes[nodes[k]].position;
+    }
+    return positions;
+}
+
 /**
  * @brief Computes the centroid of a triangle in 3D space.
  *
@@ -162,18 +190,19 @@ double tetra_volume(const Point3D& p1,
 /**
  * @brief Computes centroid, area, and characteristic length of a polygon.
  *
- * @param nodes List of polygon vertices in order.
+ * @param nodes Polygon vertices in order.
+ * @param n_nodes Number of vertices.
  * @return Tuple (centroid, area, characteristic length).
  */
 std::tuple<Point3D, double, double>
-polygon_properties(const std::vector<Point3D>& nodes) {
-    const int n = nodes.size();
+polygon_properties(const Point3D* nodes, int n_nodes) {
+    const int n = n_nodes;
 
     Point3D h = {0.0, 0.0, 0.0};
-    for (const auto& p : nodes) {
-        h[0] += p[0];
-        h[1] += p[1];
-        h[2] += p[2];
+    for (int i = 0; i < n; ++i) {
+        h[0] += nodes[i][0];
+        h[1] += nodes[i][1];
+        h[2] += nodes[i][2];
     }
     h[0] /= n; h[1] /= n; h[2] /= n;
 
@@ -223,11 +252,11 @@ polygon_properties(const std::vector<Point3D>& nodes) {
  *
  * Assumes the hexahedron is convex and nodes are ordered consistently.
  *
- * @param nodes List of 8 hexahedron vertices.
+ * @param nodes The 8 hexahedron vertices.
  * @return Tuple (centroid, volume, characteristic length).
  */
 std::tuple<Point3D, double, double>
-hexa_properties(const std::vector<Point3D>& nodes) {
+hexa_properties(const Point3D* nodes) {
     static const int hexa_index[24] = {
         1, 2, 3, 4,
         1, 5, 6, 2,
@@ -238,9 +267,9 @@ hexa_properties(const std::vector<Point3D>& nodes) {
     };
 
     Point3D H = {0.0, 0.0, 0.0};
-    for (const auto& p : nodes)
+    for (int k = 0; k < 8; ++k)
         for (int i = 0; i < 3; ++i)
-            H[i] += p[i];
+            H[i] += nodes[k][i];
     for (int i = 0; i < 3; ++i)
         H[i] /= 8.0;
 
@@ -275,11 +304,11 @@ hexa_properties(const std::vector<Point3D>& nodes) {
 /**
  * @brief Computes centroid, volume, and characteristic length of a prism.
  *
- * @param nodes List of prism vertices.
+ * @param nodes The 6 prism vertices.
  * @return Tuple (centroid, volume, characteristic length).
  */
 std::tuple<Point3D, double, double>
-prism_properties(const std::vector<Point3D>& nodes) {
+prism_properties(const Point3D* nodes) {
     static const int prism_index[18] = {
         1, 4, 6, 3,
         2, 3, 6, 5,
@@ -289,9 +318,9 @@ prism_properties(const std::vector<Point3D>& nodes) {
     };
 
     Point3D H = {0.0, 0.0, 0.0};
-    for (const auto& p : nodes)
+    for (int k = 0; k < 6; ++k)
         for (int i = 0; i < 3; ++i)
-            H[i] += p[i];
+            H[i] += nodes[k][i];
     for (int i = 0; i < 3; ++i)
         H[i] /= 6.0;
 
@@ -337,11 +366,11 @@ prism_properties(const std::vector<Point3D>& nodes) {
 /**
  * @brief Computes centroid, volume, and characteristic length of a pyramid.
  *
- * @param nodes List of pyramid vertices.
+ * @param nodes The 5 pyramid vertices.
  * @return Tuple (centroid, volume, characteristic length).
  */
 std::tuple<Point3D, double, double>
-pyramid_properties(const std::vector<Point3D>& nodes) {
+pyramid_properties(const Point3D* nodes) {
     static const int pyramid_index[16] = {
         4, 3, 2, 1,
         1, 2, 5,
@@ -351,9 +380,9 @@ pyramid_properties(const std::vector<Point3D>& nodes) {
     };
 
     Point3D H = {0.0, 0.0, 0.0};
-    for (const auto& p : nodes)
+    for (int k = 0; k < 5; ++k)
         for (int i = 0; i < 3; ++i)
-            H[i] += p[i];
+            H[i] += nodes[k][i];
     for (int i = 0; i < 3; ++i)
         H[i] /= 5.0;
 
@@ -398,7 +427,8 @@ pyramid_properties(const std::vector<Point3D>& nodes) {
  * @brief Computes centroid, volume, and characteristic length of a polyhedron.
  *
  * The polyhedron may have an arbitrary number of faces and vertices.
- * Properties are computed via decomposition into tetrahedra.
+ * Properties are computed via decomposition into tetrahedra, reading node
+ * coordinates in place without temporary storage.
  *
  * @param n_faces Number of faces.
  * @param nodes Node indices defining the polyhedron.
@@ -408,22 +438,19 @@ pyramid_properties(const std::vector<Point3D>& nodes) {
 std::tuple<Point3D, double, double>
 polyhedron_properties(const int n_faces,
                       const std::vector<int>& nodes,
-                      Mesh& mesh) {
+                      const Mesh& mesh) {
     Point3D H = {0.0, 0.0, 0.0};
     int total_vertices = 0;
-    std::vector<int> all_vertex_indices;
 
     size_t index = 0;
     for (int f = 0; f < n_faces; ++f) {
         int N = nodes[index++];
         total_vertices += N;
         for (int i = 0; i < N; ++i)
-            all_vertex_indices.push_back(nodes[index++]);
+            for (int d = 0; d < 3; ++d)
+                H[d] += mesh.nodes[nodes[index + i]].position[d];
+        index += N;
     }
-
-    for (int idx : all_vertex_indices)
-        for (int d = 0; d < 3; ++d)
-            H[d] += mesh.nodes[idx].position[d];
     for (int d = 0; d < 3; ++d)
         H[d] /= static_cast<double>(total_vertices);
 
@@ -433,16 +460,13 @@ polyhedron_properties(const int n_faces,
     index = 0;
     for (int f = 0; f < n_faces; ++f) {
         int N = nodes[index++];
-
-        std::vector<int> face_indices(
-            nodes.begin() + index, nodes.begin() + index + N
-        );
+        const int* face_indices = nodes.data() + index;
         index += N;
 
         Point3D h = {0.0, 0.0, 0.0};
-        for (int vi : face_indices)
+        for (int i = 0; i < N; ++i)
             for (int d = 0; d < 3; ++d)
-                h[d] += mesh.nodes[vi].position[d];
+                h[d] += mesh.nodes[face_indices[i]].position[d];
         for (int d = 0; d < 3; ++d)
             h[d] /= static_cast<double>(N);
 
@@ -34,8 +34,10 @@
 #include <cmath>
 #include <iomanip>
 #include <limits>
+#include <utility>
 #include <omp.h>
 
+#include <eulercpp/math/reduction.hpp>
 #include <eulercpp/math/vectors.hpp>
 #include <eulercpp/simulation/simulation.hpp>
 #include <eulercpp/output/logger.hpp>
@@ -46,7 +48,8 @@ namespace eulercpp::probes {
  * @brief Initialize probes and assign each to its closest mesh element.
  *
  * For every probe defined in the input file, the nearest element centroid
- * is found (parallelized with OpenMP). A CSV file is opened and the header
+ * is found with a deterministic parallel reduction (ties go to the lowest
+ * element index). A CSV file is opened and the header
  * line is written.
  *
  * @param sim Simulation object containing mesh and input data.
@@ -63,30 +66,22 @@ std::ofstream init_probes(Simulation& sim, const std::string& filepath) {
 
     for (auto& probe : input.output.probes) {
         auto& loc = probe.location;
-        double min_dist = std::numeric_limits<double>::max();
-
-        #pragma omp parallel
-        {
-            double local_min_dist = std::numeric_limits<double>::max();
-            int local_i = 0;
-
-            #pragma omp for nowait
-            for (int i = 0; i < mesh.n_elements; ++i) {
-                auto& c = mesh.elements[i].centroid;
-                double dist = math::distance(c, loc);
-                if (dist < local_min_dist) {
-                    local_min_dist = dist;
-                    local_i = i;
-                }
-            }
 
-            #pragma omp critical
-            {
-                if (local_min_dist < min_dist) {
-                    probe.element = local_i;
-                }
+        /// Closest element, the lowest index winning ties
+        using Candidate = std::pair<double, int>;
+        const Candidate closest = math::blocked_reduce(
+            mesh.n_elements,
+            Candidate{std::numeric_limits<double>::max(), 0},
+            [&](int i, Candidate& acc) {
+                const double dist =
+                    math::distance(mesh.elements[i].centroid, loc);
+                if (dist < acc.first) acc = {dist, i};
+            },
+            [](Candidate& a, const Candidate& b) {
+                if (b.first < a.first) a = b;
             }
-        }
+        );
+        probe.element = closest.second;
     }
 
     std::ofstream ofs(filepath + ".csv");
@@ -109,9 +104,9 @@ std::ofstream init_probes(Simulation& sim, const std::string& filepath) {
  * Data is written in scientific notation with 7-digit precision.
  *
  * @param sim Constant reference to the simulation object.
- * @param ofs Reference to the probes output file stream.
+ * @param ofs Reference to the probes output stream.
  */
-void write_probes(const Simulation& sim, std::ofstream& ofs) {
+void write_probes(const Simulation& sim, std::ostream& ofs) {
     Logger::debug() << "Saving probes data...";
 
     const Mesh& mesh = sim.mesh;
@@ -119,7 +114,6 @@ void write_probes(const Simulation& sim, std::ofstream& ofs) {
     const Input& input = sim.input;
 
     const float R = input.fluid.R;
-    const float gam = input.fluid.gamma;
     const float t = sim.status.time;
 
     for (auto& probe : input.output.probes) {
@@ -127,13 +121,13 @@ void write_probes(const Simulation& sim, std::ofstream& ofs) {
         const int i = probe.element;
 
         const float rho = fields.W(i, 0);
-        const float u = fields.W(i, 1) / rho;
-        const float v = fields.W(i, 2) / rho;
-        const float w = fields.W(i, 3) / rho;
+        const float u = fields.P(i, prim::u);
+        const float v = fields.P(i, prim::v);
+        const float w = fields.P(i, prim::w);
         const float V2 = u*u + v*v + w*w;
-        const float p = (gam-1.0)*(fields.W(i, 4) - 0.5*rho*V2);
+        const float p = fields.P(i, prim::p);
         const float T = p / rho / R;
-        const float M = std::sqrt(V2 / (gam * R * T));
+        const float M = std::sqrt(V2) / fields.P(i, prim::a);
 
         ofs << t << "," << c[0] << "," << c[1] << "," << c[2] << ","
             << rho << "," << u << "," << v << "," << w << ","
@@ -36,6 +36,8 @@
 #include <limits>
 #include <omp.h>
 
+#include <eulercpp/math/reduction.hpp>
+#include <eulercpp/math/vectors.hpp>
 #include <eulercpp/simulation/simulation.hpp>
 #include <eulercpp/output/logger.hpp>
 
@@ -76,40 +78,64 @@ std::ofstream init_reports(const Simulation& sim, const std::string& filepath) {
 /**
  * @brief Write global reports data to the CSV file at the current timestep.
  *
- * Results are written to the CSV file in scientific notation with 7-digit
- * precision.
+ * Face contributions are accumulated with a deterministic blocked
+ * reduction, so reports do not depend on the number of threads. Moments
+ * are `sum (x_f - cg) x F_f` over the boundary faces. Results are written
+ * to the CSV file in scientific notation with 7-digit precision.
  *
  * @param sim Constant reference to the simulation object.
- * @param ofs Reference to the reports output file stream.
+ * @param ofs Reference to the reports output stream.
  */
-void write_reports(const Simulation& sim, std::ofstream& ofs) {
+void write_reports(const Simulation& sim, std::ostream& ofs) {
     Logger::debug() << "Saving reports...";
 
     const Mesh& mesh = sim.mesh;
     const Fields& fields = sim.fields;
     const Input& input = sim.input;
 
-    const float time = sim.status.time;
+    const double time = sim.status.time;
+
+    /// Accumulated quantities: mdot, F[3], M[3]
+    using Integrals = std::array<double, 7>;
 
     for (auto& report : input.output.reports) {
         const auto& cg = report.cg;
         const int b = report.boundary;
 
-        float mdot = 0.0;
-        std::array<float, 3> F = {0.0};
-        std::array<float, 3> M = {0.0};
-
-        for (int f = 0; f < mesh.n_faces; ++f) {
-            const auto& face = mesh.faces[f];
-            if (face.flag == b) {
-                const auto& c = face.centroid;
-                mdot += fields.F(f, 0);
+        const Integrals sum = math::blocked_reduce(
+            mesh.n_faces, Integrals{0.0},
+            [&](int f, Integrals& acc) {
+                const auto& face = mesh.faces[f];
+                if (face.flag != b) return;
+
+                const int u = face.unique;
+                const double sign = face.sign;
+                const math::Vector3D force = {
+                    sign * fields.F(u, 1),
+                    sign * fields.F(u, 2),
+                    sign * fields.F(u, 3)
+                };
+                const math::Vector3D arm = {
+                    face.centroid[0] - cg[0],
+                    face.centroid[1] - cg[1],
+                    face.centroid[2] - cg[2]
+                };
+                const math::Vector3D moment =
+                    math::cross_product(arm, force);
+
+                acc[0] += sign * fields.F(u, 0);
                 for (int dim = 0; dim < 3; ++dim) {
-                    F[dim] += fields.F(f, dim+1);
-                    M[dim] += F[dim] * (c[dim]-cg[dim]);
+                    acc[1 + dim] += force[dim];
+                    acc[4 + dim] += moment[dim];
                 }
+            },
+            [](Integrals& a, const Integrals& c) {
+                for (int k = 0; k < 7; ++k) a[k] += c[k];
             }
-        }
+        );
+        const double mdot = sum[0];
+        const double* F = &sum[1];
+        const double* M = &sum[4];
 
         ofs << time << "," << b+1 << "," << mdot << ","
             << F[0] << "," << F[1] << "," << F[2] << ","
@@ -47,6 +47,9 @@ namespace eulercpp {
  * - Number of conserved variables.
  * - Field values for each element.
  *
+ * Values are written element by element in mesh file order, independently
+ * of the in-memory field layout and of element renumbering.
+ *
  * @param sim The simulation object containing the mesh, fields, and status.
  * @param filepath Path to the restart file to write.
  *
@@ -71,8 +74,12 @@ void write_restart_bin(const Simulation& sim, const std::string& filepath) {
         << sim.mesh.n_elements << " "
         << 5 << "\n";
 
-    ofs.write(reinterpret_cast<const char*>(fields.Wdata()),
-              mesh.n_elements * 5 * sizeof(double));
+    for (int k = 0; k < mesh.n_elements; ++k) {
+        const int i = mesh.from_file(k);
+        double W[5];
+        for (int v = 0; v < 5; ++v) W[v] = fields.W(i, v);
+        ofs.write(reinterpret_cast<const char*>(W), sizeof(W));
+    }
 
     if (!ofs) {
         throw std::runtime_error("Error writing binary restart file.");
@@ -118,7 +125,8 @@ void write_restart_ascii(const Simulation& sim, const std::string& filepath) {
         << sim.mesh.n_elements << "\n"
         << 5 << "\n";
 
-    for (int i = 0; i < sim.mesh.n_elements; ++i) {
+    for (int k = 0; k < sim.mesh.n_elements; ++k) {
+        const int i = sim.mesh.from_file(k);
         for (int v = 0; v < 5; ++v) {
             ofs << sim.fields.W(i, v) << " ";
         }
@@ -59,18 +59,18 @@ void write_csv(const Simulation& sim, const std::string& filepath) {
            "Pressure,Temperature,Mach\n";
 
     const float R = input.fluid.R;
-    const float gam = input.fluid.gamma;
 
-    for (int i = 0; i < mesh.n_elements; ++i) {
+    for (int k = 0; k < mesh.n_elements; ++k) {
+        const int i = mesh.from_file(k);
         const auto& c = mesh.elements[i].centroid;
         const float rho = fields.W(i, 0);
-        const float u = fields.W(i, 1) / rho;
-        const float v = fields.W(i, 2) / rho;
-        const float w = fields.W(i, 3) / rho;
+        const float u = fields.P(i, prim::u);
+        const float v = fields.P(i, prim::v);
+        const float w = fields.P(i, prim::w);
         const float V2 = u*u + v*v + w*w;
-        const float p = (gam-1.0)*(fields.W(i, 4) - 0.5*rho*V2);
+        const float p = fields.P(i, prim::p);
         const float T = p / rho / R;
-        const float M = std::sqrt(V2 / (gam * R * T));
+        const float M = std::sqrt(V2) / fields.P(i, prim::a);
 
         ofs << c[0] << "," << c[1] << "," << c[2] << ","
             << rho << "," << u << "," << v << "," << w << ","
@@ -75,7 +75,8 @@ void write_vtk_ascii(const Simulation& sim, const std::string& filepath) {
     }
 
     int total_indices = 0;
-    for (const auto& elem : mesh.elements) {
+    for (int k = 0; k < mesh.n_elements; ++k) {
+        const auto& elem = mesh.elements[mesh.from_file(k)];
         if (elem.type == ElementType::POLYHEDRON) {
             int cell_size = 1;
             int pos = 0;
@@ -91,7 +92,8 @@ void write_vtk_ascii(const Simulation& sim, const std::string& filepath) {
     }
 
     ofs << "CELLS " << mesh.n_elements << " " << total_indices << "\n";
-    for (const auto& elem : mesh.elements) {
+    for (int k = 0; k < mesh.n_elements; ++k) {
+        const auto& elem = mesh.elements[mesh.from_file(k)];
         if (elem.type == ElementType::POLYHEDRON) {
             int pos = 0;
             int cell_size = 1;
@@ -121,7 +123,8 @@ void write_vtk_ascii(const Simulation& sim, const std::string& filepath) {
     }
 
     ofs << "CELL_TYPES " << mesh.n_elements << "\n";
-    for (const auto& elem : mesh.elements) {
+    for (int k = 0; k < mesh.n_elements; ++k) {
+        const auto& elem = mesh.elements[mesh.from_file(k)];
         int vtk_type = 0;
         switch (elem.type) {
             case ElementType::LINEAR:        vtk_type = 3; break;
@@ -143,7 +146,6 @@ void write_vtk_ascii(const Simulation& sim, const std::string& filepath) {
     ofs << "CELL_DATA " << mesh.n_elements << "\n";
 
     const float R = input.fluid.R;
-    const float gam = input.fluid.gamma;
 
     std::vector<std::array<float, 3>> velocity(mesh.n_elements);
     std::vector<float> pressure(mesh.n_elements);
@@ -151,27 +153,28 @@ void write_vtk_ascii(const Simulation& sim, const std::string& filepath) {
     std::vector<float> mach(mesh.n_elements);
 
     #pragma omp parallel for
-    for (int i = 0; i < mesh.n_elements; ++i) {
+    for (int k = 0; k < mesh.n_elements; ++k) {
+        const int i = mesh.from_file(k);
         const float rho = fields.W(i, 0);
-        const float u   = fields.W(i, 1) / rho;
-        const float v   = fields.W(i, 2) / rho;
-        const float w   = fields.W(i, 3) / rho;
+        const float u   = fields.P(i, prim::u);
+        const float v   = fields.P(i, prim::v);
+        const float w   = fields.P(i, prim::w);
         const float V2  = u*u + v*v + w*w;
 
-        const float p = (gam - 1.0f) * (fields.W(i, 4) - 0.5f * rho * V2);
+        const float p = fields.P(i, prim::p);
         const float T = p / (rho * R);
-        const float a2 = gam * p / rho;
+        const float a = fields.P(i, prim::a);
 
-        velocity[i] = {u, v, w};
-        pressure[i] = p;
-        temperature[i] = T;
-        mach[i] = std::sqrt(V2 / a2);
+        velocity[k] = {u, v, w};
+        pressure[k] = p;
+        temperature[k] = T;
+        mach[k] = std::sqrt(V2) / a;
     }
 
     ofs << "SCALARS Density float 1\n";
     ofs << "LOOKUP_TABLE default\n";
-    for (int i = 0; i < mesh.n_elements; ++i) {
-        ofs << fields.W(i, 0) << "\n";
+    for (int k = 0; k < mesh.n_elements; ++k) {
+        ofs << fields.W(mesh.from_file(k), 0) << "\n";
     }
 
     ofs << "VECTORS Velocity float\n";
@@ -257,7 +260,8 @@ void write_vtk_bin(const Simulation& sim, const std::string& filepath) {
 
     // Cell connectivity
     int total_indices = 0;
-    for (const auto& elem : mesh.elements) {
+    for (int k = 0; k < mesh.n_elements; ++k) {
+        const auto& elem = mesh.elements[mesh.from_file(k)];
         if (elem.type == ElementType::POLYHEDRON) {
             int cell_size = 1;
             int pos = 0;
@@ -274,7 +278,8 @@ void write_vtk_bin(const Simulation& sim, const std::string& filepath) {
 
     // Connectivity
     ofs << "CELLS " << mesh.n_elements << " " << total_indices << "\n";
-    for (const auto& elem : mesh.elements) {
+    for (int k = 0; k < mesh.n_elements; ++k) {
+        const auto& elem = mesh.elements[mesh.from_file(k)];
         if (elem.type == ElementType::POLYHEDRON) {
             int pos = 0;
             int cell_size = 1; // number_of_faces
@@ -319,7 +324,8 @@ void write_vtk_bin(const Simulation& sim, const std::string& filepath) {
 
     // Cell types
     ofs << "CELL_TYPES " << mesh.n_elements << "\n";
-    for (const auto& elem : mesh.elements) {
+    for (int k = 0; k < mesh.n_elements; ++k) {
+        const auto& elem = mesh.elements[mesh.from_file(k)];
         int vtk_type = 0;
         switch (elem.type) {
             case ElementType::LINEAR:        vtk_type = 3;  break;
@@ -342,7 +348,6 @@ void write_vtk_bin(const Simulation& sim, const std::string& filepath) {
     ofs << "CELL_DATA " << mesh.n_elements << "\n";
 
     const float R = input.fluid.R;
-    const float gam = input.fluid.gamma;
 
     std::vector<float> density(mesh.n_elements);
     std::vector<std::array<float, 3>> velocity(mesh.n_elements);
@@ -351,22 +356,23 @@ void write_vtk_bin(const Simulation& sim, const std::string& filepath) {
     std::vector<float> mach(mesh.n_elements);
 
     #pragma omp parallel for
-    for (int i = 0; i < mesh.n_elements; ++i) {
+    for (int k = 0; k < mesh.n_elements; ++k) {
+        const int i = mesh.from_file(k);
         const float rho = fields.W(i, 0);
-        const float u   = fields.W(i, 1) / rho;
-        const float v   = fields.W(i, 2) / rho;
-        const float w   = fields.W(i, 3) / rho;
+        const float u   = fields.P(i, prim::u);
+        const float v   = fields.P(i, prim::v);
+        const float w   = fields.P(i, prim::w);
         const float V2  = u*u + v*v + w*w;
 
-        const float p = (gam - 1.0f) * (fields.W(i, 4) - 0.5f * rho * V2);
+        const float p = fields.P(i, prim::p);
         const float T = p / (rho * R);
-        const float a2 = gam * p / rho;
+        const float a = fields.P(i, prim::a);
 
-        density[i] = rho;
-        velocity[i] = {u, v, w};
-        pressure[i] = p;
-        temperature[i] = T;
-        mach[i] = std::sqrt(V2 / a2);
+        density[k] = rho;
+        velocity[k] = {u, v, w};
+        pressure[k] = p;
+        temperature[k] = T;
+        mach[k] = std::sqrt(V2) / a;
     }
 
     auto write_scalar = [&](const char* name, const std::vector<float>& data) {
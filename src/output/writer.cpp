@@ -51,6 +51,9 @@ std::string Writer::output_dir_ = "./output";
 std::string Writer::output_name_ = "output";
 std::ofstream Writer::probes_stream;
 std::ofstream Writer::reports_stream;
+bool Writer::buffered_ = false;
+std::ostringstream Writer::probes_buffer_;
+std::ostringstream Writer::reports_buffer_;
 
 void Writer::configure(
     int fmt, int restart_fmt,
@@ -120,11 +123,41 @@ void Writer::init_reports(const Simulation& sim) {
 }
 
 void Writer::save_probes(const Simulation& sim) {
-    probes::write_probes(sim, probes_stream);
+    if (buffered_) {
+        probes_buffer_.copyfmt(probes_stream);
+        probes::write_probes(sim, probes_buffer_);
+    } else {
+        probes::write_probes(sim, probes_stream);
+    }
 }
 
 void Writer::save_reports(const Simulation& sim) {
-    reports::write_reports(sim, reports_stream);
+    if (buffered_) {
+        reports_buffer_.copyfmt(reports_stream);
+        reports::write_reports(sim, reports_buffer_);
+    } else {
+        reports::write_reports(sim, reports_stream);
+    }
+}
+
+void Writer::set_buffered(bool enable) {
+    flush_buffers();
+    buffered_ = enable;
+}
+
+void Writer::flush_buffers() {
+    if (probes_buffer_.tellp() > 0) {
+        probes_stream << probes_buffer_.str();
+    }
+    if (reports_buffer_.tellp() > 0) {
+        reports_stream << reports_buffer_.str();
+    }
+    discard_buffers();
+}
+
+void Writer::discard_buffers() {
+    probes_buffer_.str("");
+    reports_buffer_.str("");
 }
 
 } // namespace eulercpp
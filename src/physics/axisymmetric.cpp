@@ -45,21 +45,12 @@ namespace eulercpp::physics {
  */
 void axisymmetry_sources(Simulation& sim) {
     const auto& mesh = sim.mesh;
-    const auto& input = sim.input;
     auto& fields = sim.fields;
 
     #pragma omp parallel for
     for (int i = 0; i < mesh.n_elements; ++i) {
-        const double gam = input.fluid.gamma;
-        const double rho = fields.W(i, 0);
-        const double rhoV2 = (
-            fields.W(i, 1)*fields.W(i, 1) +
-            fields.W(i, 2)*fields.W(i, 2) +
-            fields.W(i, 3)*fields.W(i, 3)
-        )/fields.W(i, 0);
-        const double E = fields.W(i, 4);
-        double p = (gam-1.0)*(E-0.5*rhoV2);
-        if (p < 0.0) p = 1.0e-14;
+        double p = fields.P(i, prim::p);
+        p = p < 0.0 ? 1.0e-14 : p;
         fields.S(i, 2) += p / mesh.elements[i].centroid[1];
     }
 }
@@ -77,8 +68,10 @@ void init_axisymmetry(Simulation& sim) {
     const double PI = 3.14159265358979323846;
 
     #pragma omp parallel for
-    for (auto& elem : mesh.elements) {
+    for (int i = 0; i < mesh.n_elements; ++i) {
+        auto& elem = mesh.elements[i];
         elem.volume *= 2.0 * PI * elem.centroid[1];
+        mesh.volumes[i] = elem.volume;
     }
 
     #pragma omp parallel for
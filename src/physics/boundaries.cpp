@@ -55,10 +55,12 @@ void apply_boundary_conditions(Simulation& sim) {
     auto& fields = sim.fields;
 
     #pragma omp parallel for
-    for (int f = 0; f < mesh.n_faces; ++f) {
-        const auto& face = mesh.faces[f];
-        if (face.opposite != -1) continue;
+    for (int u = 0; u < mesh.n_unique_faces; ++u) {
+        const auto& uface = mesh.unique_faces[u];
+        if (uface.right != -1) continue;
 
+        const int f = uface.left;
+        const auto& face = mesh.faces[f];
         const auto& bc = input.bc.boundaries[face.flag];
 
         switch (bc.type) {
@@ -98,7 +100,7 @@ void apply_boundary_conditions(Simulation& sim) {
 
         double A = face.area;
         for (int v = 0; v < 5; ++v) {
-            fields.F(f, v) *= A;
+            fields.F(u, v) *= A;
         }
     }
 }
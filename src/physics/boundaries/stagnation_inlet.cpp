@@ -192,11 +192,11 @@ void stagnation_inlet(
         }
     }
 
-    fields.F(f, 0) = rho * un;
-    fields.F(f, 1) = p * n[0] + rho * u * un;
-    fields.F(f, 2) = p * n[1] + rho * v * un;
-    fields.F(f, 3) = p * n[2] + rho * w * un;
-    fields.F(f, 4) = (E + p) * un;
+    fields.F(face.unique, 0) = rho * un;
+    fields.F(face.unique, 1) = p * n[0] + rho * u * un;
+    fields.F(face.unique, 2) = p * n[1] + rho * v * un;
+    fields.F(face.unique, 3) = p * n[2] + rho * w * un;
+    fields.F(face.unique, 4) = (E + p) * un;
 }
 
 } // namespace eulercpp::physics::bc
@@ -57,9 +57,9 @@ void symmetry(
     double p = (input.fluid.gamma-1.0)*(E-0.5*rho*(u*u+v*v+w*w));
     if (p < 0.0) p = 1.0e-14;
 
-    fields.F(f, 1) = p * n[0];
-    fields.F(f, 2) = p * n[1];
-    fields.F(f, 3) = p * n[2];
+    fields.F(face.unique, 1) = p * n[0];
+    fields.F(face.unique, 2) = p * n[1];
+    fields.F(face.unique, 3) = p * n[2];
 }
 
 } // namespace eulercpp::physics::bc
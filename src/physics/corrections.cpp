@@ -22,14 +22,16 @@
  * @file corrections.cpp
  * @brief Implements solution corrections for unphysical values.
  *
- * Checks for NaNs, Infs, or unphysical states in the conserved variables
- * and applies local averaging corrections using neighboring cells.
+ * Applies local averaging corrections, using neighboring cells, to the
+ * cells flagged as unphysical (NaN, Inf, negative density or pressure)
+ * by the solution update.
  *
  * @author Alessio Improta
  */
 
 #include <omp.h>
 
+#include <eulercpp/physics/corrections.hpp>
 #include <eulercpp/simulation/simulation.hpp>
 #include <eulercpp/output/logger.hpp>
 
@@ -38,127 +40,97 @@ namespace eulercpp::physics {
 /**
  * @brief Apply local corrections to unphysical solution values.
  *
- * The function checks each element in the mesh for NaN/Inf values or
- * unphysical conserved variables (negative density or pressure). If found,
- * the solution is corrected using weighted averages of neighboring cells'
- * previous state.
+ * Only the cells listed in `fields.unphysical_cells()` by the solution
+ * update are visited. Their solution is corrected using averages of
+ * neighboring cells' previous state, and the primitive cache of each
+ * corrected cell is refreshed. The number of corrected cells is added to
+ * `status.corrections` for the CFL controller.
  *
  * Parallelized with OpenMP for improved performance.
  *
  * @param sim The Simulation object.
  *
- * @throws std::runtime_error if the number of corrections exceeds a threshold.
+ * @throws FloatingPointError if the number of corrections exceeds a
+ * threshold.
  */
 void apply_corrections(Simulation& sim) {
     const auto& input = sim.input;
     const auto& mesh = sim.mesh;
+    const auto& csr = mesh.csr;
     auto& fields = sim.fields;
 
-    const int n_elements = mesh.n_elements;
+    const std::vector<int>& cells = fields.unphysical_cells();
     const int n_var = 5;
 
-    int corrections = 0;  // Total number of corrections made.
+    // Total number of corrections made.
+    const int corrections = static_cast<int>(cells.size());
+    if (corrections == 0) return;
 
-    #pragma omp parallel
-    {
-        int thread_corrections = 0;  // Corrections made by the current thread.
-
-        #pragma omp for
-        for (int i = 0; i < n_elements; ++i) {
-            bool corrected = false;
-
-            // Check if the solution value is NaN or Inf.
-            for (int v = 0; v < n_var; ++v) {
-                if (std::isnan(fields.W(i, v)) || std::isinf(fields.W(i, v))) {
-                    corrected = true;
-                    break;
+    // If the number of corrections exceeds the threshold,
+    // terminate the simulation.
+    if (corrections > 0.1 * mesh.n_boundaries) {
+        throw FloatingPointError();
+    }
+    sim.status.corrections += corrections;
+
+    #pragma omp parallel for
+    for (int k = 0; k < corrections; ++k) {
+        const int i = cells[k];
+        for (int v = 0; v < n_var; ++v) {
+            double correction = 0.0;
+            int den = 0;
+            for (int s = csr.begin(i); s < csr.end(i); ++s) {
+                int n = csr.neighbors[s];
+                if (n < 0) continue;
+                if (std::isnan(fields.Wold(n, v)) ||
+                    std::isinf(fields.Wold(n, v))) {
+                    continue;
                 }
+                double Kn = 0.5*(
+                    fields.Wold(n, 1)*fields.Wold(n, 1) +
+                    fields.Wold(n, 2)*fields.Wold(n, 2) +
+                    fields.Wold(n, 3)*fields.Wold(n, 3)
+                ) / fields.Wold(n, 0);
+                if (fields.Wold(n, 0) < 0.0 ||
+                    fields.Wold(n, 4) < Kn) {
+                    continue;
+                }
+                correction += fields.Wold(n, v);
+                den++;
             }
-
-            // Check if the solution value is unphysical.
-            double K = 0.5*(
-                fields.W(i, 1)*fields.W(i, 1) +
-                fields.W(i, 2)*fields.W(i, 2) +
-                fields.W(i, 3)*fields.W(i, 3)
-            ) / fields.W(i, 0);
-            if (fields.W(i, 4) < K || fields.W(i, 0) < 0.0) {
-                corrected = true;
-            }
-
-            if (corrected) {
-                const auto& elem = mesh.elements[i];
-                const int n_f = elem.n_faces;
-                thread_corrections++;  // Increment thread's correction count.
-                for (int v = 0; v < n_var; ++v) {
-                    double correction = 0.0;
-                    int den = 0;
-                    for (int f = 0; f < n_f; ++f) {
-                        int n = elem.neighbors[f];
-                        if (n < 0) continue;
-                        if (std::isnan(fields.Wold(n, v)) ||
-                            std::isinf(fields.Wold(n, v))) {
+            if (den == 0) {
+                for (int s = csr.begin(i); s < csr.end(i); ++s) {
+                    const int n = csr.neighbors[s];
+                    if (n < 0) continue;
+                    for (int sn = csr.begin(n); sn < csr.end(n); ++sn) {
+                        int nn = csr.neighbors[sn];
+                        if (nn < 0) continue;
+                        if (std::isnan(fields.Wold(nn, v)) ||
+                            std::isinf(fields.Wold(nn, v))) {
                             continue;
                         }
-                        double Kn = 0.5*(
-                            fields.Wold(n, 1)*fields.Wold(n, 1) +
-                            fields.Wold(n, 2)*fields.Wold(n, 2) +
-                            fields.Wold(n, 3)*fields.Wold(n, 3)
-                        ) / fields.Wold(n, 0);
-                        if (fields.Wold(n, 0) < 0.0 ||
-                            fields.Wold(n, 4) < Kn) {
+                        double Knn = 0.5*(
+                            fields.Wold(nn, 1)*fields.Wold(nn, 1) +
+                            fields.Wold(nn, 2)*fields.Wold(nn, 2) +
+                            fields.Wold(nn, 3)*fields.Wold(nn, 3)
+                        ) / fields.Wold(nn, 0);
+                        if (fields.Wold(nn, 0) < 0.0 ||
+                            fields.Wold(nn, 4) < Knn) {
                             continue;
                         }
-                        correction += fields.Wold(n, v);
+                        correction += fields.Wold(nn, v);
                         den++;
                     }
-                    if (den == 0) {
-                        for (int f = 0; f < n_f; ++f) {
-                            const int n = elem.neighbors[f];
-                            const auto& elem_n = mesh.elements[n];
-                            const int n_fn = elem_n.n_faces;
-                            if (n < 0) continue;
-                            for (int fn = 0; fn < n_fn; ++fn) {
-                                int nn = elem_n.neighbors[fn];
-                                if (nn < 0) continue;
-                                if (std::isnan(fields.Wold(nn, v)) ||
-                                    std::isinf(fields.Wold(nn, v))) {
-                                    continue;
-                                }
-                                double Knn = 0.5*(
-                                    fields.Wold(nn, 1)*fields.Wold(nn, 1) +
-                                    fields.Wold(nn, 2)*fields.Wold(nn, 2) +
-                                    fields.Wold(nn, 3)*fields.Wold(nn, 3)
-                                ) / fields.Wold(nn, 0);
-                                if (fields.Wold(nn, 0) < 0.0 ||
-                                    fields.Wold(nn, 4) < Knn) {
-                                    continue;
-                                }
-                                correction += fields.Wold(nn, v);
-                                den++;
-                            }
-                        }
-                    }
-                    fields.W(i, v) = correction / den;
                 }
             }
+            fields.W(i, v) = correction / den;
         }
-
-        // Update the global corrections count atomically.
-        #pragma omp atomic
-        corrections += thread_corrections;
-    }
-
-    // If the number of corrections exceeds the threshold,
-    // terminate the simulation.
-    if (corrections > 0.1 * mesh.n_boundaries) {
-        throw std::runtime_error("A floating point error has occurred.");
+        fields.update_primitives(i);
     }
 
-    // Print a message indicating how many
-    // corrections were applied, if necessary.
-    if (corrections > 0)
-        Logger::debug() << "corrections limited on "
-                        << corrections << " cells.";
+    // Print a message indicating how many corrections were applied.
+    Logger::debug() << "corrections limited on "
+                    << corrections << " cells.";
 }
 
 } // namespace eulercpp::physics
@@ -25,6 +25,8 @@
  * This file contains the implementation of convective flux computation
  * across mesh faces. It uses a Riemann solver in the face-normal coordinate
  * system and projects the fluxes back to the global coordinate system.
+ * Faces are processed in batches of `riemann_width`, so that the Riemann
+ * solver runs on full SIMD registers.
  *
  * Parallelized with OpenMP for improved performance.
  *
@@ -42,72 +44,162 @@
 namespace eulercpp::physics {
 
 /**
- * @brief Compute convective fluxes across all mesh faces.
+ * @brief Flux batch of a thread.
  *
- * For each face, the function:
- * 1. Extracts the left and right states in the face-normal coordinate system.
- * 2. Calls the Riemann solver to compute fluxes across the face.
- * 3. Maps the fluxes back to the global coordinate system.
- * 4. Scales the fluxes by the face area.
+ * Face-normal states and fluxes are stored variable by variable,
+ * `W[v*riemann_width + lane]`, as expected by `riemann_batch`.
+ */
+struct FluxBatch {
+    alignas(64) double WL[5 * riemann_width]; /**< Left states */
+    alignas(64) double WR[5 * riemann_width]; /**< Right states */
+    alignas(64) double F[5 * riemann_width];  /**< Fluxes */
+    int faces[riemann_width];                 /**< Unique faces of the lanes */
+    int n = 0;                                /**< Number of used lanes */
+};
+
+/**
+ * @brief Rotate the state of a half-face into the face-normal frame.
  *
- * This operation is parallelized using OpenMP.
+ * @param fields Fields holding the reconstructed face values.
+ * @param i      Half-face index of the state.
+ * @param face   Half-face defining the frame.
+ * @param W      Pointer to the batch states.
+ * @param lane   Destination lane.
+ */
+static inline void
+load_state(const Fields& fields, int i, const Face& face, double* W, int lane) {
+    constexpr int B = riemann_width;
+    const auto& n  = face.normal;
+    const auto& t1 = face.t1;
+    const auto& t2 = face.t2;
+
+    W[0*B + lane] = fields.Wf(i, 0);
+    W[1*B + lane] = fields.Wf(i, 1) * n[0] +
+                    fields.Wf(i, 2) * n[1] +
+                    fields.Wf(i, 3) * n[2];
+    W[2*B + lane] = fields.Wf(i, 1) * t1[0] +
+                    fields.Wf(i, 2) * t1[1] +
+                    fields.Wf(i, 3) * t1[2];
+    W[3*B + lane] = fields.Wf(i, 1) * t2[0] +
+                    fields.Wf(i, 2) * t2[1] +
+                    fields.Wf(i, 3) * t2[2];
+    W[4*B + lane] = fields.Wf(i, 4);
+}
+
+/**
+ * @brief Solve a batch and store the fluxes of its used lanes.
  *
- * @param sim Reference to the Simulation object.
+ * Unused lanes are filled with copies of the first one, so that the
+ * Riemann solver always works on valid states. Fluxes are mapped back to
+ * the global coordinate system and scaled by the face area.
+ *
+ * @tparam Solver Batched Riemann solver callable.
+ * @param sim    Reference to the Simulation object.
+ * @param batch  Batch to flush; emptied on return.
+ * @param solver Batched Riemann solver.
  */
-void compute_fluxes(Simulation& sim) {
+template <class Solver>
+static inline void flush(Simulation& sim, FluxBatch& batch, Solver solver) {
+    constexpr int B = riemann_width;
     const auto& mesh = sim.mesh;
     auto& fields = sim.fields;
-    const int n_var = 5;
 
-    #pragma omp parallel for
-    for (int i = 0; i < mesh.n_faces; ++i) {
-        const auto& face = mesh.faces[i];
-        const int j = face.opposite;
-        if (j < 0) continue;
+    for (int l = batch.n; l < B; ++l) {
+        for (int v = 0; v < 5; ++v) {
+            batch.WL[v*B + l] = batch.WL[v*B];
+            batch.WR[v*B + l] = batch.WR[v*B];
+        }
+    }
+
+    solver(batch.WL, batch.WR, batch.F, sim.input.fluid.gamma);
 
+    const double* Fr = batch.F;
+    for (int l = 0; l < batch.n; ++l) {
+        const int u = batch.faces[l];
+        const auto& face = mesh.faces[mesh.unique_faces[u].left];
         const auto& n  = face.normal;
         const auto& t1 = face.t1;
         const auto& t2 = face.t2;
+        const double A = face.area;
 
-        std::array<double, 5> WL, WR, Fr;
-
-        WL[0] = fields.Wf(i, 0);
-        WL[1] = fields.Wf(i, 1) * n[0] +
-                fields.Wf(i, 2) * n[1] +
-                fields.Wf(i, 3) * n[2];
-        WL[2] = fields.Wf(i, 1) * t1[0] +
-                fields.Wf(i, 2) * t1[1] +
-                fields.Wf(i, 3) * t1[2];
-        WL[3] = fields.Wf(i, 1) * t2[0] +
-                fields.Wf(i, 2) * t2[1] +
-                fields.Wf(i, 3) * t2[2];
-        WL[4] = fields.Wf(i, 4);
-
-        WR[0] = fields.Wf(j, 0);
-        WR[1] = fields.Wf(j, 1) * n[0] +
-                fields.Wf(j, 2) * n[1] +
-                fields.Wf(j, 3) * n[2];
-        WR[2] = fields.Wf(j, 1) * t1[0] +
-                fields.Wf(j, 2) * t1[1] +
-                fields.Wf(j, 3) * t1[2];
-        WR[3] = fields.Wf(j, 1) * t2[0] +
-                fields.Wf(j, 2) * t2[1] +
-                fields.Wf(j, 3) * t2[2];
-        WR[4] = fields.Wf(j, 4);
-
-        riemann(WL.data(), WR.data(), Fr.data(), sim.input.fluid.gamma);
-
-        fields.F(i, 0) = Fr[0];
-        fields.F(i, 1) = Fr[1] * n[0] + Fr[2] * t1[0] + Fr[3] * t2[0];
-        fields.F(i, 2) = Fr[1] * n[1] + Fr[2] * t1[1] + Fr[3] * t2[1];
-        fields.F(i, 3) = Fr[1] * n[2] + Fr[2] * t1[2] + Fr[3] * t2[2];
-        fields.F(i, 4) = Fr[4];
+        const double F0 = Fr[0*B + l];
+        const double F1 = Fr[1*B + l];
+        const double F2 = Fr[2*B + l];
+        const double F3 = Fr[3*B + l];
+        const double F4 = Fr[4*B + l];
+
+        fields.F(u, 0) = F0 * A;
+        fields.F(u, 1) = (F1 * n[0] + F2 * t1[0] + F3 * t2[0]) * A;
+        fields.F(u, 2) = (F1 * n[1] + F2 * t1[1] + F3 * t2[1]) * A;
+        fields.F(u, 3) = (F1 * n[2] + F2 * t1[2] + F3 * t2[2]) * A;
+        fields.F(u, 4) = F4 * A;
+    }
+    batch.n = 0;
+}
 
-        const double A = face.area;
-        for (int v = 0; v < n_var; ++v) {
-            fields.F(i, v) *= A;
+/**
+ * @brief Compute convective fluxes across all interior unique faces.
+ *
+ * Each pair of opposite half-faces is visited once, through its unique
+ * face, and the flux is stored with the orientation of the left
+ * half-face. Each thread:
+ * 1. Gathers the left and right states of `riemann_width` faces in the
+ *    face-normal coordinate system.
+ * 2. Calls the batched Riemann solver on the whole batch.
+ * 3. Maps the fluxes back to the global coordinate system.
+ * 4. Scales the fluxes by the face area.
+ *
+ * This operation is parallelized using OpenMP.
+ *
+ * @tparam Solver Batched Riemann solver callable.
+ * @param sim    Reference to the Simulation object.
+ * @param solver Batched Riemann solver.
+ */
+template <class Solver>
+static void compute_interior_fluxes(Simulation& sim, Solver solver) {
+    const auto& mesh = sim.mesh;
+    const auto& fields = sim.fields;
+
+    #pragma omp parallel
+    {
+        FluxBatch batch;
+
+        #pragma omp for
+        for (int u = 0; u < mesh.n_unique_faces; ++u) {
+            const auto& uface = mesh.unique_faces[u];
+            const int i = uface.left;
+            const int j = uface.right;
+            if (j < 0) continue;
+
+            const auto& face = mesh.faces[i];
+            load_state(fields, i, face, batch.WL, batch.n);
+            load_state(fields, j, face, batch.WR, batch.n);
+            batch.faces[batch.n++] = u;
+
+            if (batch.n == riemann_width) flush(sim, batch, solver);
         }
+
+        if (batch.n > 0) flush(sim, batch, solver);
     }
 }
 
+/**
+ * @brief Compute convective fluxes with a Riemann solver selected at
+ *        compile time.
+ *
+ * @tparam R Riemann solver.
+ * @param sim Reference to the Simulation object.
+ */
+template <Riemann R>
+void compute_fluxes(Simulation& sim) {
+    compute_interior_fluxes(sim, [](const double* WL, const double* WR,
+                                    double* F, const double gam) {
+        riemann_batch<R>(WL, WR, F, gam);
+    });
+}
+
+template void compute_fluxes<Riemann::RUSANOV>(Simulation&);
+template void compute_fluxes<Riemann::HLL>(Simulation&);
+template void compute_fluxes<Riemann::HLLC>(Simulation&);
+
 } // namespace eulercpp::physics
@@ -27,19 +27,76 @@
  * and contact discontinuities along the face-normal direction.
  * Ensures positive pressures and avoids numerical instabilities.
  *
+ * Every solver is written once as a template over a SIMD batch type
+ * (see simd.hpp) and processes `width` faces at a time. Branches on the
+ * wave speeds are replaced by masked selections, so that all lanes follow
+ * the same instruction stream.
+ *
  * @author Alessio Improta
  */
 
 #include <array>
 #include <cmath>
 #include <iostream>
+#include <stdexcept>
 
+#include <eulercpp/math/simd.hpp>
 #include <eulercpp/physics/riemann.hpp>
 
 namespace eulercpp::physics {
 
-/** @brief Internal pointer to the current Riemann solver */
-static RiemannSolver riemann_solver = nullptr;
+namespace simd = eulercpp::math::simd;
+
+/**
+ * @struct States
+ * @brief Left and right states, pressures and physical fluxes of a batch.
+ *
+ * Inputs are stored variable by variable, i.e. `W[v*width + lane]`.
+ */
+template <class B>
+struct States {
+    B WL[5], WR[5];         /**< Conservative states */
+    B FL[5], FR[5];         /**< Physical fluxes */
+    B rhoL, rhoR;           /**< Densities */
+    B unL, unR;             /**< Normal velocities */
+    B pL, pR;               /**< Pressures */
+    B aL, aR;               /**< Speeds of sound */
+
+    States(const double* wl, const double* wr, const double gam) {
+        constexpr int W = B::width;
+        for (int v = 0; v < 5; ++v) {
+            WL[v] = B::load(wl + v * W);
+            WR[v] = B::load(wr + v * W);
+        }
+
+        const B g(gam), h(0.5), one(1.0), zero(0.0), eps(1.0e-14);
+
+        rhoL = WL[0];                 rhoR = WR[0];
+        unL = WL[1] / rhoL;           unR = WR[1] / rhoR;
+        const B ut1L = WL[2] / rhoL,  ut1R = WR[2] / rhoR;
+        const B ut2L = WL[3] / rhoL,  ut2R = WR[3] / rhoR;
+        const B EL = WL[4],           ER = WR[4];
+
+        pL = (g-one)*(EL-h*rhoL*(unL*unL+ut1L*ut1L+ut2L*ut2L));
+        pR = (g-one)*(ER-h*rhoR*(unR*unR+ut1R*ut1R+ut2R*ut2R));
+        pL = select(lt(pL, zero), eps, pL);
+        pR = select(lt(pR, zero), eps, pR);
+        aL = sqrt(g * pL / rhoL);
+        aR = sqrt(g * pR / rhoR);
+
+        FL[0] = rhoL * unL;
+        FL[1] = rhoL * unL * unL + pL;
+        FL[2] = rhoL * unL * ut1L;
+        FL[3] = rhoL * unL * ut2L;
+        FL[4] = (EL + pL) * unL;
+
+        FR[0] = rhoR * unR;
+        FR[1] = rhoR * unR * unR + pR;
+        FR[2] = rhoR * unR * ut1R;
+        FR[3] = rhoR * unR * ut2R;
+        FR[4] = (ER + pR) * unR;
+    }
+};
 
 /**
  * @brief Rusanov Riemann solver
@@ -48,46 +105,23 @@ static RiemannSolver riemann_solver = nullptr;
  * the Rusanov Riemann solver. The Rusanov solver uses the maximum wave speed
  * to estimate the flux at the interface.
  *
- * @param WL Pointer to the left state array.
- * @param WR Pointer to the right state array.
- * @param F  Pointer to the output flux array.
+ * @tparam B SIMD batch type.
+ * @param WL Pointer to the left states (`5*width` values).
+ * @param WR Pointer to the right states (`5*width` values).
+ * @param F  Pointer to the output fluxes (`5*width` values).
  * @param gam Specific heat ratio of the fluid.
  */
-static inline void
+template <class B>
+static void
 rusanov(const double* WL, const double* WR, double* F, const double gam) {
-    double rhoL = WL[0],       rhoR = WR[0];
-    double unL  = WL[1]/rhoL,   unR = WR[1]/rhoR;
-    double ut1L = WL[2]/rhoL,  ut1R = WR[2]/rhoR;
-    double ut2L = WL[3]/rhoL,  ut2R = WR[3]/rhoR;
-    double EL   = WL[4],         ER = WR[4];
-
-    double pL = (gam-1.0)*(EL-0.5*rhoL*(unL*unL+ut1L*ut1L+ut2L*ut2L));
-    double pR = (gam-1.0)*(ER-0.5*rhoR*(unR*unR+ut1R*ut1R+ut2R*ut2R));
-    if (pL < 0) pL = 1.0e-14;
-    if (pR < 0) pR = 1.0e-14;
-    double aL = std::sqrt(gam * pL / rhoL);
-    double aR = std::sqrt(gam * pR / rhoR);
+    const States<B> s(WL, WR, gam);
+    const B h(0.5);
 
-    double FL[5] = {
-        rhoL * unL,
-        rhoL * unL * unL + pL,
-        rhoL * unL * ut1L,
-        rhoL * unL * ut2L,
-        (EL + pL) * unL
-    };
-
-    double FR[5] = {
-        rhoR * unR,
-        rhoR * unR * unR + pR,
-        rhoR * unR * ut1R,
-        rhoR * unR * ut2R,
-        (ER + pR) * unR
-    };
-
-    double S = std::max(std::abs(unL) + aL, std::abs(unR) + aR);
+    const B S = max(abs(s.unL) + s.aL, abs(s.unR) + s.aR);
 
     for (int v = 0; v < 5; ++v) {
-        F[v] = 0.5 * (FL[v] + FR[v]) - 0.5 * S * (WR[v] - WL[v]);
+        const B Fv = h * (s.FL[v] + s.FR[v]) - h * S * (s.WR[v] - s.WL[v]);
+        Fv.store(F + v * B::width);
     }
 }
 
@@ -98,58 +132,28 @@ rusanov(const double* WL, const double* WR, double* F, const double gam) {
  * the HLL (Harten-Lax-van Leer) solver. The HLL solver is a Godunov-type
  * method which approximates the flux based on the wave speeds.
  *
- * @param WL Pointer to the left state array.
- * @param WR Pointer to the right state array.
- * @param F  Pointer to the output flux array.
+ * @tparam B SIMD batch type.
+ * @param WL Pointer to the left states (`5*width` values).
+ * @param WR Pointer to the right states (`5*width` values).
+ * @param F  Pointer to the output fluxes (`5*width` values).
  * @param gam Specific heat ratio of the fluid.
  */
-static inline void
+template <class B>
+static void
 hll(const double* WL, const double* WR, double* F, const double gam) {
-    double rhoL = WL[0],       rhoR = WR[0];
-    double unL  = WL[1]/rhoL,   unR = WR[1]/rhoR;
-    double ut1L = WL[2]/rhoL,  ut1R = WR[2]/rhoR;
-    double ut2L = WL[3]/rhoL,  ut2R = WR[3]/rhoR;
-    double EL   = WL[4],         ER = WR[4];
-
-    double pL = (gam-1.0)*(EL-0.5*rhoL*(unL*unL+ut1L*ut1L+ut2L*ut2L));
-    double pR = (gam-1.0)*(ER-0.5*rhoR*(unR*unR+ut1R*ut1R+ut2R*ut2R));
-    if (pL < 0) pL = 1.0e-14;
-    if (pR < 0) pR = 1.0e-14;
-    double aL = std::sqrt(gam * pL / rhoL);
-    double aR = std::sqrt(gam * pR / rhoR);
-
-    double FL[5] = {
-        rhoL * unL,
-        rhoL * unL * unL + pL,
-        rhoL * unL * ut1L,
-        rhoL * unL * ut2L,
-        (EL + pL) * unL
-    };
-
-    double FR[5] = {
-        rhoR * unR,
-        rhoR * unR * unR + pR,
-        rhoR * unR * ut1R,
-        rhoR * unR * ut2R,
-        (ER + pR) * unR
-    };
+    const States<B> s(WL, WR, gam);
+    const B zero(0.0);
 
-    double SL = std::min(unL, unR) - std::max(aL, aR);
-    double SR = std::max(unL, unR) + std::max(aL, aR);
+    const B SL = min(s.unL, s.unR) - max(s.aL, s.aR);
+    const B SR = max(s.unL, s.unR) + max(s.aL, s.aR);
+    const auto left = gt(SL, zero);
+    const auto right = lt(SR, zero);
 
-    if (SL > 0.0) {
-        for (int v = 0; v < 5; ++v) {
-            F[v] = FL[v];
-        }
-    } else if (SR < 0.0) {
-        for (int v = 0; v < 5; ++v) {
-            F[v] = FR[v];
-        }
-    } else {
-        const double dS = SR - SL;
-        for (int v = 0; v < 5; ++v) {
-            F[v] = ((SR*FL[v]-SL*FR[v]) + SL*SR*(WR[v]-WL[v])) / dS;
-        }
+    const B dS = SR - SL;
+    for (int v = 0; v < 5; ++v) {
+        const B Fm = ((SR*s.FL[v]-SL*s.FR[v]) + SL*SR*(s.WR[v]-s.WL[v])) / dS;
+        const B Fv = select(left, s.FL[v], select(right, s.FR[v], Fm));
+        Fv.store(F + v * B::width);
     }
 }
 
@@ -161,102 +165,68 @@ hll(const double* WL, const double* WR, double* F, const double gam) {
  * the HLL by including a contact wave, leading to a more accurate flux
  * calculation.
  *
- * @param WL Pointer to the left state array.
- * @param WR Pointer to the right state array.
- * @param F  Pointer to the output flux array.
+ * @tparam B SIMD batch type.
+ * @param WL Pointer to the left states (`5*width` values).
+ * @param WR Pointer to the right states (`5*width` values).
+ * @param F  Pointer to the output fluxes (`5*width` values).
  * @param gam Specific heat ratio of the fluid.
  */
-static inline void
+template <class B>
+static void
 hllc(const double* WL, const double* WR, double* F, const double gam) {
-    double rhoL = WL[0],       rhoR = WR[0];
-    double unL  = WL[1]/rhoL,   unR = WR[1]/rhoR;
-    double ut1L = WL[2]/rhoL,  ut1R = WR[2]/rhoR;
-    double ut2L = WL[3]/rhoL,  ut2R = WR[3]/rhoR;
-    double EL   = WL[4],         ER = WR[4];
-
-    double pL = (gam-1.0)*(EL-0.5*rhoL*(unL*unL+ut1L*ut1L+ut2L*ut2L));
-    double pR = (gam-1.0)*(ER-0.5*rhoR*(unR*unR+ut1R*ut1R+ut2R*ut2R));
-    if (pL < 0) pL = 1.0e-14;
-    if (pR < 0) pR = 1.0e-14;
-    double aL = std::sqrt(gam * pL / rhoL);
-    double aR = std::sqrt(gam * pR / rhoR);
-
-    double FL[5] = {
-        rhoL * unL,
-        rhoL * unL * unL + pL,
-        rhoL * unL * ut1L,
-        rhoL * unL * ut2L,
-        (EL + pL) * unL
-    };
-
-    double FR[5] = {
-        rhoR * unR,
-        rhoR * unR * unR + pR,
-        rhoR * unR * ut1R,
-        rhoR * unR * ut2R,
-        (ER + pR) * unR
-    };
-
-    double SL = std::min(unL, unR) - std::max(aL, aR);
-    double SR = std::max(unL, unR) + std::max(aL, aR);
-
-    if (SL > 0.0) {
-        for (int v = 0; v < 5; ++v) {
-            F[v] = FL[v];
-        }
-    } else if (SR < 0.0) {
-        for (int v = 0; v < 5; ++v) {
-            F[v] = FR[v];
-        }
-    } else {
-        double SM = (pR - pL + WL[1]*(SL - unL) - WR[1]*(SR - unR))
-                    / (rhoL * (SL - unL) - rhoR * (SR - unR));
-        double pM = 0.5 * (
-            pL + pR + rhoL*(SL-unL)*(SM-unL) + rhoR*(SR-unR)*(SM-unR)
-        );
-        double D[] = {0.0, 1.0, 0.0, 0.0, SM};
-
-        if (SM > 0.0) {
-            const double dSL = SL - SM;
-            for (int v = 0; v < 5; ++v) {
-                F[v] = (SM * (SL * WL[v] - FL[v]) + SL * pM * D[v]) / dSL;
-            }
-        } else {
-            const double dSR = SR - SM;
-            for (int v = 0; v < 5; ++v) {
-                F[v] = (SM * (SR * WR[v] - FR[v]) + SR * pM * D[v]) / dSR;
-            }
-        }
+    const States<B> s(WL, WR, gam);
+    const B zero(0.0), one(1.0), h(0.5);
+
+    const B SL = min(s.unL, s.unR) - max(s.aL, s.aR);
+    const B SR = max(s.unL, s.unR) + max(s.aL, s.aR);
+    const auto left = gt(SL, zero);
+    const auto right = lt(SR, zero);
+
+    const B SM = (s.pR - s.pL + s.WL[1]*(SL - s.unL) - s.WR[1]*(SR - s.unR))
+                 / (s.rhoL * (SL - s.unL) - s.rhoR * (SR - s.unR));
+    const B pM = h * (
+        s.pL + s.pR + s.rhoL*(SL-s.unL)*(SM-s.unL)
+                    + s.rhoR*(SR-s.unR)*(SM-s.unR)
+    );
+    const B D[] = {zero, one, zero, zero, SM};
+    const auto star_left = gt(SM, zero);
+
+    const B dSL = SL - SM;
+    const B dSR = SR - SM;
+    for (int v = 0; v < 5; ++v) {
+        const B FsL = (SM * (SL * s.WL[v] - s.FL[v]) + SL * pM * D[v]) / dSL;
+        const B FsR = (SM * (SR * s.WR[v] - s.FR[v]) + SR * pM * D[v]) / dSR;
+        const B Fv = select(left, s.FL[v],
+                     select(right, s.FR[v],
+                     select(star_left, FsL, FsR)));
+        Fv.store(F + v * B::width);
     }
 }
 
 /**
- * @brief Compute the Riemann flux across a face.
- *
- * This function computes the Riemann flux across a face using the selected
- * Riemann solver function.
+ * @brief Compute the Riemann fluxes across a batch of faces with a solver
+ *        selected at compile time.
  *
- * @param WL Pointer to the left state array.
- * @param WR Pointer to the right state array.
- * @param F  Pointer to the output flux array.
+ * @tparam R Riemann solver.
+ * @param WL Pointer to the left states, `WL[v*riemann_width + lane]`.
+ * @param WR Pointer to the right states, `WR[v*riemann_width + lane]`.
+ * @param F  Pointer to the output fluxes, `F[v*riemann_width + lane]`.
  * @param gam Specific heat ratio of the fluid.
  */
-void riemann(const double* WL, const double* WR, double* F, const double gam) {
-    riemann_solver(WL, WR, F, gam);
+template <Riemann R>
+void riemann_batch(const double* WL, const double* WR, double* F,
+                   const double gam) {
+    using B = simd::Native;
+    if constexpr (R == Riemann::RUSANOV)    rusanov<B>(WL, WR, F, gam);
+    else if constexpr (R == Riemann::HLL)   hll<B>(WL, WR, F, gam);
+    else                                    hllc<B>(WL, WR, F, gam);
 }
 
-/**
- * @brief Initializes the Riemann solver.
- *
- * @param solver Selected Riemann solver.
- */
-void init_riemann(Riemann solver) {
-    switch (solver) {
-        case Riemann::RUSANOV:  riemann_solver = rusanov;   break;
-        case Riemann::HLL:      riemann_solver = hll;       break;
-        case Riemann::HLLC:     riemann_solver = hllc;      break;
-        default: throw std::invalid_argument("Unknown Riemann solver.");
-    }
-}
+template void riemann_batch<Riemann::RUSANOV>(
+    const double*, const double*, double*, const double);
+template void riemann_batch<Riemann::HLL>(
+    const double*, const double*, double*, const double);
+template void riemann_batch<Riemann::HLLC>(
+    const double*, const double*, double*, const double);
 
 } // namespace eulercpp::physics
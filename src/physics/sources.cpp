@@ -48,9 +48,12 @@ void update_sources(Simulation& sim) {
     const auto& mesh = sim.mesh;
     auto& fields = sim.fields;
 
-    #pragma omp parallel for
-    for (int i = 0; i < mesh.n_elements; ++i) {
-        for (int v = 0; v < 5; ++v) {
+    const int n_elements = mesh.n_elements;
+    const double* V = mesh.volumes.data();
+
+    for (int v = 0; v < 5; ++v) {
+        #pragma omp parallel for
+        for (int i = 0; i < n_elements; ++i) {
             fields.S(i, v) = 0.0;
         }
     }
@@ -59,11 +62,10 @@ void update_sources(Simulation& sim) {
         axisymmetry_sources(sim);
     }
 
-    #pragma omp parallel for
-    for (int i = 0; i < mesh.n_elements; ++i) {
-        const double V = mesh.elements[i].volume;
-        for (int v = 0; v < 5; ++v) {
-            fields.S(i, v) *= V;
+    for (int v = 0; v < 5; ++v) {
+        #pragma omp parallel for
+        for (int i = 0; i < n_elements; ++i) {
+            fields.S(i, v) *= V[i];
         }
     }
 }
@@ -24,77 +24,87 @@
  *
  * This file provides the implementation of functions that compute
  * the next simulation timestep based on CFL constraints, fluid velocity,
- * speed of sound, and element geometry.
+ * speed of sound, and element geometry, and of the CFL controller.
  *
  * @author Alessio Improta
  */
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <omp.h>
 
 #include <eulercpp/simulation/simulation.hpp>
+#include <eulercpp/math/reduction.hpp>
+#include <eulercpp/output/logger.hpp>
 
 namespace eulercpp::physics {
 
+/** @brief Largest CFL growth factor of a single update. */
+static constexpr double cfl_growth = 2.0;
+
+/** @brief CFL reduction factor after corrections. */
+static constexpr double cfl_backoff = 0.5;
+
 /**
  * @brief Compute and update the simulation timestep.
  *
  * This function computes the maximum allowable timestep for the simulation
  * based on CFL constraints. The timestep is calculated using the local
- * velocities, speed of sound, and element geometry.
+ * velocities, speed of sound (from the primitive cache), and element
+ * geometry.
  *
- * The computation is parallelized over mesh elements using OpenMP.
+ * The spectral radius of a cell is `lambda = 1/2 sum_f (|u.n| + a) A_f`,
+ * i.e. the sum over the coordinate directions of `(|u_d| + a) A_d` on a
+ * Cartesian cell, and the global step `CFL * min(V / lambda)` is reduced
+ * with `math::blocked_max`.
+ *
+ * With local time stepping, each cell additionally stores its own step
+ * `fields.dt(i) = CFL * V / lambda`. Both modes share the same spectral
+ * radius, so a CFL number means the same in both: the global step is the
+ * smallest local step, and on a uniform mesh and state both are equal.
+ * The simulation time is not advanced (pseudo-time has no physical
+ * meaning) and `maxtime` is ignored; `status.dt` keeps the global step.
  *
  * @param sim Reference to the Simulation object.
  */
 void update_timestep(Simulation& sim) {
     const auto& mesh = sim.mesh;
+    const auto& csr = mesh.csr;
     const auto& input = sim.input;
     auto& status = sim.status;
     auto& fields = sim.fields;
 
-    double var = 0.0;
-
-    #pragma omp parallel
-    {
-        double var_local = 0.0;
-
-        #pragma omp for nowait
-        for (int i = 0; i < mesh.n_elements; ++i) {
-            const auto& elem = mesh.elements[i];
-            const double rho = fields.W(i, 0);
-            const double u = fields.W(i, 1) / rho;
-            const double v = fields.W(i, 2) / rho;
-            const double w = fields.W(i, 3) / rho;
-            const double K = 0.5*rho*(u*u+v*v+w*w);
-            const double p = (input.fluid.gamma-1.0)*(fields.W(i, 4) - K);
-            const double a = std::sqrt(input.fluid.gamma * p / rho);
-
-            double l_max = 0.0;
-            for (int f = 0; f < elem.n_faces; ++f) {
-                const int fi = elem.faces[f];
-                const auto& face = mesh.faces[fi];
-                std::array<double, 3> n = face.normal;
-                const double un = u*n[0] + v*n[1] + w*n[2];
-                l_max = std::max(l_max, face.area * (un + a));
-            }
-
-            double ratio = l_max / elem.volume;
-            if (ratio > var_local) {
-                var_local = ratio;
-            }
+    const bool local = input.numerical.local_timestep;
+    const double cfl = status.cfl;
+
+    const double var = math::blocked_max(mesh.n_elements, 0.0, [&](int i) {
+        const double u = fields.P(i, prim::u);
+        const double v = fields.P(i, prim::v);
+        const double w = fields.P(i, prim::w);
+        const double a = fields.P(i, prim::a);
+
+        double l_sum = 0.0;
+        for (int s = csr.begin(i); s < csr.end(i); ++s) {
+            const auto& face = mesh.faces[s];
+            std::array<double, 3> n = face.normal;
+            const double un = u*n[0] + v*n[1] + w*n[2];
+            l_sum += face.area * (std::abs(un) + a);
         }
+        const double lambda = 0.5 * l_sum;
 
-        #pragma omp critical
-        {
-            if (var_local > var) {
-                var = var_local;
-            }
+        if (local) {
+            fields.dt(i) = cfl * mesh.volumes[i] / lambda;
         }
-    }
+        return lambda / mesh.volumes[i];
+    });
 
-    double dtconv = status.cfl / var;
+    double dtconv = cfl / var;
     status.dt = dtconv;
+
+    /// Pseudo-time is not advanced with local time steps
+    if (local) return;
+
     status.time += dtconv;
 
     if (status.time > input.numerical.maxtime) {
@@ -103,4 +113,35 @@ void update_timestep(Simulation& sim) {
     }
 }
 
+/**
+ * @brief Adapts the CFL number to the residual history.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void update_cfl(Simulation& sim) {
+    const auto& numerical = sim.input.numerical;
+    auto& status = sim.status;
+
+    const int corrections = status.corrections;
+    status.corrections = 0;
+    if (!numerical.cfl_ramp) return;
+
+    const double residual = sim.fields.residuals().L2[0];
+
+    /// Corrections at the lowest CFL number are not caused by the ramp
+    if (corrections > 0 && status.cfl > status.cfl_min) {
+        status.cfl = std::max(status.cfl_min, cfl_backoff * status.cfl);
+        Logger::debug() << "CFL reduced to " << status.cfl << " after "
+                        << corrections << " corrections.";
+    } else if (status.cfl_residual > 0.0 && residual > 0.0 &&
+               std::isfinite(residual)) {
+        const double ratio =
+            std::min(cfl_growth, status.cfl_residual / residual);
+        status.cfl = std::clamp(status.cfl * ratio,
+                                status.cfl_min, numerical.CFL_max);
+    }
+
+    status.cfl_residual = residual;
+}
+
 } // namespace eulercpp::physics
@@ -28,7 +28,7 @@
  *
  * Functions:
  * - set_initial_conditions: loads either restart or default initial conditions
- * - initialize_simulation: sets up limiters, reconstruction, physics and output
+ * - initialize_simulation: selects the solver stage, sets up physics and output
  *
  * Supports parallel initialization using OpenMP for faster setup.
  *
@@ -42,6 +42,7 @@
 #include <omp.h>
 
 #include <eulercpp/simulation/initialization.hpp>
+#include <eulercpp/simulation/pipeline.hpp>
 #include <eulercpp/simulation/simulation.hpp>
 #include <eulercpp/math/gradients.hpp>
 #include <eulercpp/math/reconstruction.hpp>
@@ -63,6 +64,8 @@ namespace eulercpp {
  * - Block-specific initial conditions
  * - Error handling for mismatched restart files
  *
+ * The primitive cache is filled from the initial solution.
+ *
  * @param sim Reference to the Simulation object to initialize.
  * @throws std::runtime_error if the restart file cannot be read or
  * contains errors.
@@ -73,6 +76,7 @@ void set_initial_conditions(Simulation& sim) {
     Fields& fields = sim.fields;
 
     sim.status.cfl = input.numerical.CFL;
+    sim.status.cfl_min = input.numerical.CFL;
 
     if (input.init.restart == 1) {
         Logger::info() << "Loading restart file " << input.init.restart_file;
@@ -118,13 +122,14 @@ void set_initial_conditions(Simulation& sim) {
                 sim.status.iteration = iter;
                 sim.status.time = time;
 
-                for (int i = 0; i < mesh.n_elements; ++i) {
+                for (int k = 0; k < mesh.n_elements; ++k) {
+                    const int i = mesh.from_file(k);
                     for (int v = 0; v < 5; ++v) {
                         file >> fields.W(i, v);
                         if (!file) {
                             std::stringstream ss;
                             ss << "Error reading restart data at element "
-                               << i << " variable " << v;
+                               << k << " variable " << v;
                             throw std::runtime_error(ss.str());
                         }
                     }
@@ -161,8 +166,12 @@ void set_initial_conditions(Simulation& sim) {
                 sim.status.iteration = iter;
                 sim.status.time = time;
 
-                file.read(reinterpret_cast<char*>(fields.Wdata()),
-                        mesh.n_elements * 5 * sizeof(double));
+                for (int k = 0; k < mesh.n_elements; ++k) {
+                    const int i = mesh.from_file(k);
+                    double W[5];
+                    file.read(reinterpret_cast<char*>(W), sizeof(W));
+                    for (int v = 0; v < 5; ++v) fields.W(i, v) = W[v];
+                }
 
                 if (!file) {
                     throw std::runtime_error(
@@ -207,14 +216,16 @@ void set_initial_conditions(Simulation& sim) {
             }
         }
     }
+
+    fields.update_primitives();
 }
 
 /**
  * @brief Initialize simulation components and numerical schemes.
  *
  * This function performs the following:
- * - Initializes the numerical limiter
- * - Selects the reconstruction scheme
+ * - Selects the specialized solver stage
+ * - Reports local time stepping
  * - Configures axisymmetric physics if needed
  * - Sets up output format and output folder for results
  *
@@ -223,11 +234,12 @@ void set_initial_conditions(Simulation& sim) {
 void initialize_simulation(Simulation& sim) {
     auto& input = sim.input;
 
-    math::init_limiter(input.numerical.limiter);
+    init_pipeline(sim);
 
-    math::init_reconstruction(input.numerical.reconstruction);
-
-    physics::init_riemann(input.numerical.riemann);
+    if (input.numerical.local_timestep) {
+        Logger::info() << "Local time stepping enabled: "
+                          "maxtime is ignored.";
+    }
 
     if (input.physics.dimension == 2) {
         physics::init_axisymmetry(sim);
@@ -0,0 +1,192 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file pipeline.cpp
+ * @brief Implements the compile-time specialized solver stage.
+ *
+ * The residual evaluation of a stage is a template over the Riemann
+ * solver, the reconstruction scheme, the limiter and the spatial
+ * dimension. All instantiations are generated here and the one matching
+ * the input is stored in a function pointer, called once per stage,
+ * followed by the selected solution update (explicit, LU-SGS or
+ * Newton-Krylov) and the corrections.
+ *
+ * MUSCL stages compute gradients and face values in a single fused pass.
+ * Piecewise constant reconstruction does not use gradients, limiter or
+ * dimension, so it has a single instantiation per Riemann solver.
+ *
+ * @author Alessio Improta
+ */
+
+#include <stdexcept>
+
+#include <eulercpp/simulation/pipeline.hpp>
+#include <eulercpp/simulation/simulation.hpp>
+#include <eulercpp/physics/boundaries.hpp>
+#include <eulercpp/physics/corrections.hpp>
+#include <eulercpp/physics/fluxes.hpp>
+#include <eulercpp/math/lusgs.hpp>
+#include <eulercpp/math/newton_krylov.hpp>
+#include <eulercpp/math/reconstruction.hpp>
+#include <eulercpp/math/solution_update.hpp>
+
+namespace eulercpp {
+
+using math::Limiter;
+using math::Reconstruction;
+using math::TimeIntegration;
+using physics::Riemann;
+
+/** @brief Internal pointer to the selected residual evaluation */
+static StageFunction residual_function = nullptr;
+
+/** @brief Internal pointer to the selected solution update */
+static StageFunction update_function = nullptr;
+
+/**
+ * @brief Residual evaluation of one stage: reconstruction, convective
+ * fluxes and boundary conditions.
+ *
+ * @tparam R   Riemann solver.
+ * @tparam S   Reconstruction scheme.
+ * @tparam L   Limiter (MUSCL only).
+ * @tparam Dim Spatial dimension (MUSCL only).
+ * @param sim Reference to the Simulation object.
+ */
+template <Riemann R, Reconstruction S, Limiter L, int Dim>
+static void residual(Simulation& sim) {
+    if constexpr (S == Reconstruction::MUSCL) {
+        math::fused_muscl_reconstruction<L, Dim>(sim);
+    } else {
+        math::constant_reconstruction(sim);
+    }
+
+    physics::compute_fluxes<R>(sim);
+    physics::apply_boundary_conditions(sim);
+}
+
+/**
+ * @brief Selects the MUSCL residual for a given dimension.
+ */
+template <Riemann R, Limiter L>
+static StageFunction select_dimension(int dim) {
+    switch (dim) {
+        case 1:     return residual<R, Reconstruction::MUSCL, L, 1>;
+        case 3:     return residual<R, Reconstruction::MUSCL, L, 3>;
+        default:    return residual<R, Reconstruction::MUSCL, L, 2>;
+    }
+}
+
+/**
+ * @brief Selects the residual for a given reconstruction and limiter.
+ */
+template <Riemann R>
+static StageFunction select_reconstruction(Reconstruction scheme,
+                                           Limiter limiter, int dim) {
+    switch (scheme) {
+        case Reconstruction::CONSTANT:
+            return residual<R, Reconstruction::CONSTANT, Limiter::MINMOD, 3>;
+        case Reconstruction::MUSCL:
+            break;
+        default: throw std::invalid_argument("Unknown reconstruction scheme.");
+    }
+
+    switch (limiter) {
+        case Limiter::MINMOD:
+            return select_dimension<R, Limiter::MINMOD>(dim);
+        case Limiter::SUPERBEE:
+            return select_dimension<R, Limiter::SUPERBEE>(dim);
+        case Limiter::VANLEER:
+            return select_dimension<R, Limiter::VANLEER>(dim);
+        case Limiter::VENKATAKRISHNAN:
+            return select_dimension<R, Limiter::VENKATAKRISHNAN>(dim);
+        case Limiter::MODVENKATAKRISHNAN:
+            return select_dimension<R, Limiter::MODVENKATAKRISHNAN>(dim);
+        default: throw std::invalid_argument("Unknown limiter.");
+    }
+}
+
+/**
+ * @brief Selects the stage instantiation matching the simulation settings.
+ *
+ * The residual evaluation depends on Riemann solver, reconstruction,
+ * limiter and dimension; the solution update on the time integration.
+ *
+ * @param sim Reference to the Simulation object.
+ * @throws std::invalid_argument if a scheme is unknown.
+ */
+void init_pipeline(const Simulation& sim) {
+    const auto& numerical = sim.input.numerical;
+    const Reconstruction scheme = numerical.reconstruction;
+    const Limiter limiter = numerical.limiter;
+    const int dim = sim.fields.dimension();
+
+    switch (numerical.riemann) {
+        case Riemann::RUSANOV:
+            residual_function =
+                select_reconstruction<Riemann::RUSANOV>(scheme, limiter, dim);
+            break;
+        case Riemann::HLL:
+            residual_function =
+                select_reconstruction<Riemann::HLL>(scheme, limiter, dim);
+            break;
+        case Riemann::HLLC:
+            residual_function =
+                select_reconstruction<Riemann::HLLC>(scheme, limiter, dim);
+            break;
+        default: throw std::invalid_argument("Unknown Riemann solver.");
+    }
+
+    switch (numerical.time_integration) {
+        case TimeIntegration::EXPLICIT:
+            update_function = math::advance_solution;
+            break;
+        case TimeIntegration::LUSGS:
+            update_function = math::lusgs_update;
+            break;
+        case TimeIntegration::NEWTON_KRYLOV:
+            update_function = math::newton_krylov_update;
+            break;
+        default: throw std::invalid_argument("Unknown time integration.");
+    }
+}
+
+/**
+ * @brief Runs one stage of the time integration.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void run_stage(Simulation& sim) {
+    residual_function(sim);
+    update_function(sim);
+    physics::apply_corrections(sim);
+}
+
+/**
+ * @brief Evaluates the convective fluxes of the current solution.
+ *
+ * @param sim Reference to the Simulation object.
+ */
+void evaluate_residual(Simulation& sim) {
+    residual_function(sim);
+}
+
+} // namespace eulercpp
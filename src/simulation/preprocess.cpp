@@ -45,6 +45,7 @@
 #include <eulercpp/physics/boundaries.hpp>
 #include <eulercpp/output/logger.hpp>
 #include <eulercpp/output/writer.hpp>
+#include <eulercpp/math/multigrid.hpp>
 #include <eulercpp/math/time_utils.hpp>
 
 namespace eulercpp {
@@ -60,7 +61,8 @@ namespace eulercpp {
  * 3. Initializing the simulation status and variables
  * 4. Applying initial conditions
  * 5. Initializing boundary conditions
- * 6. Writing the initial simulation state to output files
+ * 6. Building the multigrid levels, if enabled
+ * 7. Writing the initial simulation state to output files
  *
  * The function also measures the preprocessing time and logs messages at
  * each step to provide detailed feedback.
@@ -94,6 +96,12 @@ void preprocess(Simulation& sim) {
     physics::init_boundaries(sim);
     Logger::info() << "Boundary conditions set.";
 
+    if (input.numerical.multigrid_levels > 0) {
+        Logger::debug() << "Building multigrid levels...";
+        math::init_multigrid(sim);
+        Logger::info() << "Multigrid levels built.";
+    }
+
     Logger::debug() << "Writing initial conditions...";
     Writer::save_solution(sim);
 
@@ -0,0 +1,64 @@
+/* -------------------------------------------------------------------------- *\
+     ___ _   _ _    ___ ___  ___ ___ ___
+    | __| | | | |  | __| _ \/ __| _ \ _ \
+    | _|| |_| | |__| _||   / (__|  _/  _/
+    |___|\___/|____|___|_|_\\___|_| |_|
+
+    Copyright 2025 Alessio Improta
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+\* -------------------------------------------------------------------------- */
+/**
+ * @file snapshot.cpp
+ * @brief Implements in-memory snapshots of the simulation state.
+ *
+ * @author Alessio Improta
+ */
+
+#include <eulercpp/math/solution_update.hpp>
+#include <eulercpp/simulation/simulation.hpp>
+#include <eulercpp/simulation/snapshot.hpp>
+
+namespace eulercpp {
+
+/**
+ * @brief Saves the current solution, time and iteration.
+ *
+ * @param sim Reference to the Simulation object.
+ * @param snapshot Destination snapshot.
+ */
+void save_snapshot(const Simulation& sim, Snapshot& snapshot) {
+    sim.fields.save_conservatives(snapshot.W);
+    snapshot.time = sim.status.time;
+    snapshot.iteration = sim.status.iteration;
+}
+
+/**
+ * @brief Restores a snapshot.
+ *
+ * @param sim Reference to the Simulation object.
+ * @param snapshot Snapshot to restore.
+ */
+void restore_snapshot(Simulation& sim, const Snapshot& snapshot) {
+    sim.fields.load_conservatives(snapshot.W);
+    sim.fields.unphysical_cells().clear();
+
+    sim.status.time = snapshot.time;
+    sim.status.iteration = snapshot.iteration;
+    sim.status.cfl_residual = 0.0;
+    sim.status.corrections = 0;
+
+    math::reset_stage_counter();
+}
+
+} // namespace eulercpp
@@ -35,25 +35,27 @@
  * @author Alessio Improta
  */
 
+#include <algorithm>
 #include <ctime>
 #include <iostream>
 
+#include <eulercpp/simulation/pipeline.hpp>
 #include <eulercpp/simulation/simulation.hpp>
+#include <eulercpp/simulation/snapshot.hpp>
 #include <eulercpp/simulation/solve.hpp>
 #include <eulercpp/output/logger.hpp>
 #include <eulercpp/output/writer.hpp>
-#include <eulercpp/physics/boundaries.hpp>
 #include <eulercpp/physics/corrections.hpp>
-#include <eulercpp/physics/fluxes.hpp>
 #include <eulercpp/physics/sources.hpp>
 #include <eulercpp/physics/timestep.hpp>
-#include <eulercpp/math/gradients.hpp>
-#include <eulercpp/math/reconstruction.hpp>
-#include <eulercpp/math/solution_update.hpp>
+#include <eulercpp/math/multigrid.hpp>
 #include <eulercpp/math/time_utils.hpp>
 
 namespace eulercpp {
 
+/** @brief CFL reduction factor applied after each rollback. */
+static constexpr double rollback_cfl_cut = 0.5;
+
 /**
  * @brief Perform the main time-stepping solver loop.
  *
@@ -66,10 +68,21 @@ namespace eulercpp {
  * - Compute fluxes and apply boundary conditions
  * - Advance solution in time
  * - Apply physical corrections
+ * - Run a multigrid cycle, if enabled
+ * - Adapt the CFL number, if enabled
+ * - Save an in-memory snapshot periodically
  * - Print residuals and save output periodically
  *
- * The solver respects maximum iteration count, maximum simulation time,
- * and allows for early stopping via signal handling.
+ * The solver respects maximum iteration count, maximum simulation time
+ * (except with local time stepping, where time is not advanced), and
+ * allows for early stopping via signal handling.
+ *
+ * If too many cells need corrections (`physics::FloatingPointError`),
+ * the solution, time and iteration are rolled back to the last snapshot
+ * and the CFL number is halved, up to `rollback_attempts` times between
+ * two snapshots; then the error is propagated. Once the next snapshot is
+ * reached, the CFL number in effect before the rollbacks is restored. Probe and report rows are
+ * held in memory until the next snapshot, and dropped on rollback.
  *
  * @param sim Reference to the `Simulation` object to solve.
  */
@@ -90,23 +103,64 @@ void solve(Simulation& sim) {
     auto& iter = status.iteration;
     auto& time = status.time;
 
-    while (iter < maxiter && time < maxtime && !stopped) {
+    /// Pseudo-time does not advance with local time stepping
+    const bool local = input.numerical.local_timestep;
+    const bool multigrid = input.numerical.multigrid_levels > 0;
+
+    /// Rollback state, refreshed every `snapshot_delay` iterations
+    const int snapshot_delay = input.numerical.snapshot_delay;
+    const int max_attempts = input.numerical.rollback_attempts;
+    Snapshot snapshot;
+    int attempts = 0;
+    double cfl_before = status.cfl;
+    double cfl_min_before = status.cfl_min;
+    if (snapshot_delay > 0) {
+        save_snapshot(sim, snapshot);
+        Writer::set_buffered(true);
+    }
+
+    while (iter < maxiter && (local || time < maxtime) && !stopped) {
         iter++;
-        fields.prepare_solution_update();
 
-        physics::update_timestep(sim);
-        physics::update_sources(sim);
+        try {
+            fields.prepare_solution_update();
 
-        for (int stage = 0; stage < stages; ++stage) {
-            math::compute_gradients(sim);
-            math::reconstruction(sim);
+            physics::update_timestep(sim);
+            physics::update_sources(sim);
 
-            physics::compute_fluxes(sim);
-            physics::apply_boundary_conditions(sim);
+            for (int stage = 0; stage < stages; ++stage) {
+                run_stage(sim);
+            }
 
-            math::advance_solution(sim);
+            if (multigrid) {
+                math::multigrid_cycle(sim);
+            }
 
-            physics::apply_corrections(sim);
+            physics::update_cfl(sim);
+        } catch (const physics::FloatingPointError&) {
+            if (snapshot_delay <= 0 || attempts >= max_attempts) {
+                Writer::flush_buffers();
+                throw;
+            }
+
+            if (attempts == 0) {
+                cfl_before = status.cfl;
+                cfl_min_before = status.cfl_min;
+            }
+
+            const int failed = iter;
+            restore_snapshot(sim, snapshot);
+            Writer::discard_buffers();
+            status.cfl *= rollback_cfl_cut;
+            status.cfl_min = std::min(status.cfl_min, status.cfl);
+            ++attempts;
+
+            Logger::warning() << "Floating point error at iteration "
+                              << failed << ": rolled back to iteration "
+                              << iter << " with CFL " << status.cfl
+                              << " (attempt " << attempts << "/"
+                              << max_attempts << ").";
+            continue;
         }
 
         if ((iter - 1) % output.prints_info_delay == 0) {
@@ -137,6 +191,22 @@ void solve(Simulation& sim) {
 
         if (iter % output.restart_delay == 0)
             Writer::save_restart(sim);
+
+        if (snapshot_delay > 0 && iter % snapshot_delay == 0) {
+            save_snapshot(sim, snapshot);
+            Writer::flush_buffers();
+            if (attempts > 0) {
+                /// Clean since the rollbacks: raise the CFL number again,
+                /// the adaptive CFL ramps up from its lower bound
+                status.cfl_min = cfl_min_before;
+                status.cfl = std::max(status.cfl, input.numerical.cfl_ramp
+                                                  ? cfl_min_before
+                                                  : cfl_before);
+                Logger::info() << "CFL restored to " << status.cfl
+                               << " at iteration " << iter << ".";
+            }
+            attempts = 0;
+        }
     }
 
     if (iter >= maxiter) {
@@ -144,7 +214,7 @@ void solve(Simulation& sim) {
                        << iter << ") reached.";
     }
 
-    if (time >= maxtime) {
+    if (!local && time >= maxtime) {
         Logger::info() << "Maximum simulation time ("
                        << math::format_duration(maxtime) << ") reached.";
     }
@@ -156,6 +226,7 @@ void solve(Simulation& sim) {
     Writer::save_solution(sim);
     Writer::save_restart(sim);
 
+    Writer::set_buffered(false);
     Writer::probes_stream.close();
     Writer::reports_stream.close();
 